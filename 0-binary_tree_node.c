@@ -1,5 +1,110 @@
 #include "binary_trees.h"
 
+/* Arena currently used by the node constructors, NULL means plain malloc */
+static tree_arena_t *active_arena;
+
+/**
+ * tree_arena_use - Selects the arena the node constructors allocate from.
+ * While an arena is active, binary_tree_node (and every function built on it
+ * such as bst_insert, avl_insert, heap_insert or sorted_array_to_avl)
+ * takes its nodes from the arena slabs instead of calling malloc.
+ * Releasing a node does not depend on it: each node records whether it
+ * lives in an arena. The active arena is shared by the whole process and
+ * an arena must only be used by one thread at a time.
+ *
+ * @arena: The arena to activate, or NULL to go back to malloc.
+ *
+ * Return: The previously active arena, or NULL if there was none.
+ */
+tree_arena_t *tree_arena_use(tree_arena_t *arena)
+{
+	tree_arena_t *previous = active_arena;
+
+	active_arena = arena;
+	return (previous);
+}
+
+/**
+ * tree_arena_carve - Takes the next unused node from the slabs of an arena.
+ * Consecutive calls return consecutive nodes, a new slab being added when
+ * the current one is full. Slabs are aligned on TREE_ARENA_SLAB_BYTES so
+ * that the slab, and the arena, of a node are found from its address.
+ *
+ * @arena: A pointer to the arena.
+ *
+ * Return: A pointer to the uninitialized node, or NULL on failure.
+ */
+binary_tree_t *tree_arena_carve(tree_arena_t *arena)
+{
+	tree_slab_t *slab = arena->slabs;
+	void *memory;
+
+	if (!slab || slab->used == slab->capacity)
+	{
+		if (posix_memalign(&memory, TREE_ARENA_SLAB_BYTES,
+				   sizeof(*slab) +
+				   sizeof(binary_tree_t) * arena->slab_size))
+			return (NULL);
+		slab = memory;
+		slab->arena = arena;
+		slab->used = 0;
+		slab->capacity = arena->slab_size;
+		slab->next = arena->slabs;
+		arena->slabs = slab;
+	}
+
+	/* The nodes are laid out right after the slab header */
+	return ((binary_tree_t *)(slab + 1) + slab->used++);
+}
+
+/**
+ * tree_arena_alloc - Allocates the memory for one node from an arena.
+ * A node released to the arena is reused first, otherwise a new one is
+ * carved from its slabs.
+ *
+ * @arena: A pointer to the arena.
+ *
+ * Return: A pointer to the uninitialized node, or NULL on failure.
+ */
+binary_tree_t *tree_arena_alloc(tree_arena_t *arena)
+{
+	binary_tree_t *node = arena->free_list;
+
+	if (!node)
+		return (tree_arena_carve(arena));
+
+	arena->free_list = node->left;
+	return (node);
+}
+
+/**
+ * binary_tree_free - Releases the memory of one binary tree node.
+ * A node carved from an arena is pushed on the free list of that arena,
+ * whichever arena is active, so that it can be reused, the memory itself
+ * going away with tree_arena_release. The arena is found in O(1) from the
+ * header of the aligned slab holding the node. Any other node is freed.
+ *
+ * @node: A pointer to the node to release.
+ */
+void binary_tree_free(binary_tree_t *node)
+{
+	tree_slab_t *slab;
+
+	if (!node)
+		return;
+
+	if (!node->in_arena)
+	{
+		free(node);
+		return;
+	}
+
+	slab = (tree_slab_t *)((uintptr_t)node &
+			       ~(uintptr_t)(TREE_ARENA_SLAB_BYTES - 1));
+	node->left = slab->arena->free_list;
+	slab->arena->free_list = node;
+}
+
 /**
  * binary_tree_node - Creates a new binary tree node.
  * This function creates a new binary tree node
@@ -14,13 +119,17 @@ binary_tree_t *binary_tree_node(binary_tree_t *parent, int value)
 {
 	/* Allocate memory for the new node */
 	binary_tree_t *new = NULL;
+	tree_arena_t *arena;
 
-	new = malloc(sizeof(binary_tree_t));
+	arena = active_arena;
+	new = arena ? tree_arena_alloc(arena) : malloc(sizeof(*new));
 	if (!new)
 		return (NULL);
 
 	/* Set the value and parent of the new node */
 	new->n = value;
+	new->height = 1;
+	new->in_arena = arena != NULL;
 	new->parent = parent;
 
 	/* Set left and right children to NULL */
@@ -22,18 +22,12 @@ binary_tree_t *binary_tree_insert_left(binary_tree_t *parent, int value)
 	if (parent == NULL)
 		return (NULL);
 
-	/* Declare and initialize a new node */
-	new = malloc(sizeof(binary_tree_t));
+	/* Create and initialize the new node */
+	new = binary_tree_node(parent, value);
 
 	if (!new)
 		return (NULL);
 
-	/* Initialize the new node */
-	new->n = value;
-	new->parent = parent;
-	new->left = NULL;
-	new->right = NULL;
-
 	/* If the parent already has a left child */
 	if (parent->left != NULL)
 	{
@@ -6,6 +6,8 @@
  * binary tree rooted at the given node.
  * A left rotation involves making the right child
  * of the root node the new root and adjusting the pointers accordingly.
+ * The stored heights of the two nodes that move are recomputed from
+ * their children, so AVL trees keep valid heights.
  *
  * @tree: A pointer to the root node of the binary tree.
  *
@@ -15,6 +17,7 @@ binary_tree_t *binary_tree_rotate_left(binary_tree_t *tree)
 {
 	/* Declare and initialize pointers */
 	binary_tree_t *new = NULL, *root = NULL;
+	int left, right;
 
 	/* If the root node is NULL or has no children, no rotation is needed */
 	if (tree == NULL || (tree->left == NULL && tree->right == NULL))
@@ -42,6 +45,11 @@ binary_tree_t *binary_tree_rotate_left(binary_tree_t *tree)
 	/* Move the current root to the left of the new root */
 	new->left = tree;
 	tree->parent = new;
-	/* Return the new root after the rotation */
+	/* Keep the stored heights up to date, the lowered node first */
+	left = tree->left ? tree->left->height : 0;
+	right = tree->right ? tree->right->height : 0;
+	tree->height = (left > right ? left : right) + 1;
+	right = new->right ? new->right->height : 0;
+	new->height = (tree->height > right ? tree->height : right) + 1;
 	return (root ? root : new);
 }
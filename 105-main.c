@@ -0,0 +1,41 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	tree_arena_t *arena;
+	avl_t *avl;
+	bst_t *bst;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t n = sizeof(array) / sizeof(array[0]);
+
+	arena = tree_arena_create(8);
+	if (!arena)
+		return (1);
+	tree_arena_use(arena);
+
+	bst = array_to_bst(array, n);
+	if (!bst)
+		return (1);
+	binary_tree_print(bst);
+	bst = bst_remove(bst, 79);
+	printf("Removed 79...\n");
+	binary_tree_print(bst);
+
+	avl = array_to_avl(array, n);
+	if (!avl)
+		return (1);
+	binary_tree_print(avl);
+
+	tree_arena_release(arena);
+	return (0);
+}
@@ -0,0 +1,63 @@
+#include "binary_trees.h"
+
+/**
+ * tree_arena_create - Creates an arena to allocate tree nodes from.
+ * The arena hands out nodes from contiguous slabs of @slab_size nodes,
+ * so a tree built inside it is packed in memory and can be destroyed
+ * in one go with tree_arena_release.
+ * Nodes are only taken from the arena once it is selected with
+ * tree_arena_use.
+ *
+ * @slab_size: The number of nodes per slab, 0 or more than
+ * TREE_ARENA_SLAB_SIZE for TREE_ARENA_SLAB_SIZE.
+ *
+ * Return: A pointer to the new arena, or NULL on failure.
+ */
+tree_arena_t *tree_arena_create(size_t slab_size)
+{
+	tree_arena_t *arena;
+
+	arena = malloc(sizeof(*arena));
+	if (!arena)
+		return (NULL);
+
+	/* Slabs are allocated lazily by tree_arena_carve */
+	arena->slabs = NULL;
+	arena->free_list = NULL;
+	arena->slab_size = slab_size && slab_size < TREE_ARENA_SLAB_SIZE ?
+		slab_size : TREE_ARENA_SLAB_SIZE;
+
+	return (arena);
+}
+
+/**
+ * tree_arena_release - Releases an arena and every node allocated from it.
+ * This function frees all the slabs of the arena at once, which destroys
+ * every tree built in it without walking them like binary_tree_delete.
+ * If the arena is the active one, the node constructors go back to malloc.
+ *
+ * @arena: A pointer to the arena to release.
+ */
+void tree_arena_release(tree_arena_t *arena)
+{
+	tree_arena_t *previous;
+	tree_slab_t *slab;
+
+	if (!arena)
+		return;
+
+	/* Deactivate the arena, keeping any other active arena in place */
+	previous = tree_arena_use(NULL);
+	if (previous != arena)
+		tree_arena_use(previous);
+
+	/* Free the slabs, one call per slab instead of one per node */
+	while (arena->slabs)
+	{
+		slab = arena->slabs;
+		arena->slabs = slab->next;
+		free(slab);
+	}
+
+	free(arena);
+}
@@ -0,0 +1,159 @@
+#include "binary_trees.h"
+
+/**
+ * compact_replace_child - Points a parent at a new child.
+ *
+ * @tree: A pointer to the tree.
+ * @parent: The index of the parent, COMPACT_NIL if @old is the root.
+ * @old: The index of the child being replaced.
+ * @new: The index of the replacing child.
+ */
+void compact_replace_child(compact_tree_t *tree, uint32_t parent,
+			   uint32_t old, uint32_t new)
+{
+	if (parent == COMPACT_NIL)
+		tree->root = new;
+	else if (tree->nodes[parent].left == old)
+		tree->nodes[parent].left = new;
+	else
+		tree->nodes[parent].right = new;
+
+	if (new != COMPACT_NIL)
+		tree->nodes[new].parent = parent;
+}
+
+/**
+ * compact_rotate_left - Performs a left rotation on an index-based tree.
+ *
+ * @tree: A pointer to the tree.
+ * @node: The index of the root of the subtree to rotate.
+ *
+ * Return: The index of the new root of the subtree.
+ */
+uint32_t compact_rotate_left(compact_tree_t *tree, uint32_t node)
+{
+	compact_node_t *nodes = tree->nodes;
+	uint32_t pivot = nodes[node].right;
+
+	nodes[node].right = nodes[pivot].left;
+	if (nodes[pivot].left != COMPACT_NIL)
+		nodes[nodes[pivot].left].parent = node;
+	compact_replace_child(tree, nodes[node].parent, node, pivot);
+	nodes[pivot].left = node;
+	nodes[node].parent = pivot;
+
+	return (pivot);
+}
+
+/**
+ * compact_rotate_right - Performs a right rotation on an index-based tree.
+ *
+ * @tree: A pointer to the tree.
+ * @node: The index of the root of the subtree to rotate.
+ *
+ * Return: The index of the new root of the subtree.
+ */
+uint32_t compact_rotate_right(compact_tree_t *tree, uint32_t node)
+{
+	compact_node_t *nodes = tree->nodes;
+	uint32_t pivot = nodes[node].left;
+
+	nodes[node].left = nodes[pivot].right;
+	if (nodes[pivot].right != COMPACT_NIL)
+		nodes[nodes[pivot].right].parent = node;
+	compact_replace_child(tree, nodes[node].parent, node, pivot);
+	nodes[pivot].right = node;
+	nodes[node].parent = pivot;
+
+	return (pivot);
+}
+
+/**
+ * compact_avl_rebalance - Rotates an unbalanced node back into AVL shape.
+ * The balance factors of the rotated nodes are fixed up in place, the
+ * new root of the subtree always ends up balanced.
+ *
+ * @tree: A pointer to the tree.
+ * @node: The index of the unbalanced node.
+ * @value: The value that was just inserted below @node.
+ */
+void compact_avl_rebalance(compact_tree_t *tree, uint32_t node, int value)
+{
+	compact_node_t *nodes = tree->nodes;
+	int side = value < nodes[node].n ? 1 : -1;
+	uint32_t child, grand;
+
+	child = side > 0 ? nodes[node].left : nodes[node].right;
+	if (nodes[child].balance == side)
+	{
+		/* Left-left or right-right case: a single rotation */
+		if (side > 0)
+			compact_rotate_right(tree, node);
+		else
+			compact_rotate_left(tree, node);
+		nodes[node].balance = 0;
+		nodes[child].balance = 0;
+		return;
+	}
+
+	/* Left-right or right-left case: straighten the child first */
+	grand = side > 0 ? nodes[child].right : nodes[child].left;
+	if (side > 0)
+	{
+		compact_rotate_left(tree, child);
+		compact_rotate_right(tree, node);
+	}
+	else
+	{
+		compact_rotate_right(tree, child);
+		compact_rotate_left(tree, node);
+	}
+	nodes[node].balance = nodes[grand].balance == side ? -side : 0;
+	nodes[child].balance = nodes[grand].balance == -side ? side : 0;
+	nodes[grand].balance = 0;
+}
+
+/**
+ * compact_avl_insert - Inserts a value into an index-based AVL tree.
+ * The value is inserted as in a BST, then the path back to the root is
+ * retraced, updating the balance factor stored in each node. The walk
+ * stops at the first node whose subtree did not grow, or at the first
+ * rotation since it restores the height of that subtree, so an insert
+ * costs O(log n).
+ *
+ * @tree: A pointer to the tree.
+ * @value: The value to insert.
+ *
+ * Return: The index of the new node, or COMPACT_NIL if the value
+ * already exists or on failure.
+ */
+uint32_t compact_avl_insert(compact_tree_t *tree, int value)
+{
+	compact_node_t *nodes;
+	uint32_t new, child, node;
+	int balance;
+
+	new = compact_bst_insert(tree, value);
+	if (new == COMPACT_NIL)
+		return (COMPACT_NIL);
+
+	/* The insert may have moved the node array */
+	nodes = tree->nodes;
+	for (child = new, node = nodes[new].parent; node != COMPACT_NIL;
+	     child = node, node = nodes[node].parent)
+	{
+		balance = nodes[node].balance +
+			(nodes[node].left == child ? 1 : -1);
+		if (balance > 1 || balance < -1)
+		{
+			compact_avl_rebalance(tree, node, value);
+			break;
+		}
+		nodes[node].balance = balance;
+		/* The subtree did not grow, the ancestors are unaffected */
+		if (balance == 0)
+			break;
+	}
+
+	return (new);
+}
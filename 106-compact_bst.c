@@ -0,0 +1,73 @@
+#include "binary_trees.h"
+
+/**
+ * compact_bst_search - Searches for a value in an index-based BST.
+ *
+ * @tree: A pointer to the tree.
+ * @value: The value to search for.
+ *
+ * Return: The index of the node holding @value, or COMPACT_NIL.
+ */
+uint32_t compact_bst_search(const compact_tree_t *tree, int value)
+{
+	uint32_t node;
+
+	if (!tree)
+		return (COMPACT_NIL);
+
+	node = tree->root;
+	while (node != COMPACT_NIL && tree->nodes[node].n != value)
+	{
+		if (value < tree->nodes[node].n)
+			node = tree->nodes[node].left;
+		else
+			node = tree->nodes[node].right;
+	}
+
+	return (node);
+}
+
+/**
+ * compact_bst_insert - Inserts a value into an index-based BST.
+ * Works like bst_insert: duplicates are rejected.
+ *
+ * @tree: A pointer to the tree.
+ * @value: The value to insert.
+ *
+ * Return: The index of the new node, or COMPACT_NIL if the value
+ * already exists or on failure.
+ */
+uint32_t compact_bst_insert(compact_tree_t *tree, int value)
+{
+	uint32_t node, parent = COMPACT_NIL, new;
+
+	if (!tree)
+		return (COMPACT_NIL);
+
+	/* Find the parent of the new node */
+	node = tree->root;
+	while (node != COMPACT_NIL)
+	{
+		if (value == tree->nodes[node].n)
+			return (COMPACT_NIL);
+		parent = node;
+		if (value < tree->nodes[node].n)
+			node = tree->nodes[node].left;
+		else
+			node = tree->nodes[node].right;
+	}
+
+	new = compact_tree_node(tree, parent, value);
+	if (new == COMPACT_NIL)
+		return (COMPACT_NIL);
+
+	/* Link the new node into its parent */
+	if (parent == COMPACT_NIL)
+		tree->root = new;
+	else if (value < tree->nodes[parent].n)
+		tree->nodes[parent].left = new;
+	else
+		tree->nodes[parent].right = new;
+
+	return (new);
+}
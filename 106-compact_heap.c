@@ -0,0 +1,94 @@
+#include "binary_trees.h"
+
+/**
+ * compact_heap_insert - Inserts a value into an index-based max-heap.
+ * Heap nodes are appended in level order, so the node at index i always
+ * has its children at 2i + 1 and 2i + 2 and the last slot is simply the
+ * last node of the array. The value is then moved up along the parent
+ * links, which takes O(log n) steps.
+ *
+ * @tree: A pointer to a tree only used as a heap.
+ * @value: The value to insert.
+ *
+ * Return: The index of the node where the value ended, or COMPACT_NIL
+ * on failure.
+ */
+uint32_t compact_heap_insert(compact_tree_t *tree, int value)
+{
+	compact_node_t *nodes;
+	uint32_t node, parent;
+
+	if (!tree)
+		return (COMPACT_NIL);
+
+	parent = tree->size ? (tree->size - 1) / 2 : COMPACT_NIL;
+	node = compact_tree_node(tree, parent, value);
+	if (node == COMPACT_NIL)
+		return (COMPACT_NIL);
+
+	nodes = tree->nodes;
+	if (parent == COMPACT_NIL)
+		tree->root = node;
+	else if (node % 2)
+		nodes[parent].left = node;
+	else
+		nodes[parent].right = node;
+
+	/* Sift the value up while it is greater than its parent */
+	while (nodes[node].parent != COMPACT_NIL &&
+	       nodes[nodes[node].parent].n < value)
+	{
+		nodes[node].n = nodes[nodes[node].parent].n;
+		node = nodes[node].parent;
+	}
+	nodes[node].n = value;
+
+	return (node);
+}
+
+/**
+ * compact_heap_extract - Extracts the root of an index-based max-heap.
+ * The last node of the array is unlinked and its value is sifted down
+ * from the root, so no node count or parent search is needed.
+ *
+ * @tree: A pointer to a tree only used as a heap.
+ *
+ * Return: The value that was stored in the root, or 0 if the heap is empty.
+ */
+int compact_heap_extract(compact_tree_t *tree)
+{
+	compact_node_t *nodes;
+	uint32_t node, child, last;
+	int max, value;
+
+	if (!tree || tree->size == 0)
+		return (0);
+
+	nodes = tree->nodes;
+	max = nodes[tree->root].n;
+	last = --tree->size;
+	value = nodes[last].n;
+
+	/* Unlink the last node */
+	if (last == 0)
+	{
+		tree->root = COMPACT_NIL;
+		return (max);
+	}
+	compact_replace_child(tree, nodes[last].parent, last, COMPACT_NIL);
+
+	/* Sift the value of the last node down from the root */
+	for (node = tree->root; nodes[node].left != COMPACT_NIL; node = child)
+	{
+		child = nodes[node].left;
+		if (nodes[node].right != COMPACT_NIL &&
+		    nodes[nodes[node].right].n > nodes[child].n)
+			child = nodes[node].right;
+		if (nodes[child].n <= value)
+			break;
+		nodes[node].n = nodes[child].n;
+	}
+	nodes[node].n = value;
+
+	return (max);
+}
@@ -0,0 +1,120 @@
+#include "binary_trees.h"
+
+/**
+ * compact_tree_create - Creates an empty index-based binary tree.
+ * The nodes of a compact tree live in one array and are linked with
+ * 32-bit indices instead of pointers, so a node takes 16 bytes
+ * instead of the 32 bytes of a binary_tree_t.
+ *
+ * @capacity: The number of nodes to reserve room for, 0 for a default.
+ *
+ * Return: A pointer to the new tree, or NULL on failure.
+ */
+compact_tree_t *compact_tree_create(size_t capacity)
+{
+	compact_tree_t *tree;
+
+	if (capacity == 0)
+		capacity = 16;
+	if (capacity >= COMPACT_NIL)
+		return (NULL);
+
+	tree = malloc(sizeof(*tree));
+	if (!tree)
+		return (NULL);
+
+	tree->nodes = malloc(sizeof(*tree->nodes) * capacity);
+	if (!tree->nodes)
+	{
+		free(tree);
+		return (NULL);
+	}
+	tree->root = COMPACT_NIL;
+	tree->size = 0;
+	tree->capacity = (uint32_t)capacity;
+
+	return (tree);
+}
+
+/**
+ * compact_tree_delete - Deletes an index-based binary tree.
+ * All the nodes are stored in a single array, so the whole tree
+ * is released with two calls to free.
+ *
+ * @tree: A pointer to the tree to delete.
+ */
+void compact_tree_delete(compact_tree_t *tree)
+{
+	if (!tree)
+		return;
+
+	free(tree->nodes);
+	free(tree);
+}
+
+/**
+ * compact_tree_node - Appends a new node to an index-based binary tree.
+ * The node array doubles when it is full, so node addresses may change
+ * across calls and nodes must always be referred to by index.
+ * The new node is not linked into its parent.
+ *
+ * @tree: A pointer to the tree.
+ * @parent: The index of the parent node, COMPACT_NIL for the root.
+ * @value: The value to be stored in the new node.
+ *
+ * Return: The index of the new node, or COMPACT_NIL on failure.
+ */
+uint32_t compact_tree_node(compact_tree_t *tree, uint32_t parent, int value)
+{
+	compact_node_t *nodes, *new;
+	size_t capacity;
+
+	if (!tree)
+		return (COMPACT_NIL);
+
+	/* Grow the node array when it is full */
+	if (tree->size == tree->capacity)
+	{
+		capacity = (size_t)tree->capacity * 2;
+		if (capacity >= COMPACT_NIL)
+			capacity = COMPACT_NIL - 1;
+		if (capacity <= tree->size)
+			return (COMPACT_NIL);
+		nodes = realloc(tree->nodes, sizeof(*nodes) * capacity);
+		if (!nodes)
+			return (COMPACT_NIL);
+		tree->nodes = nodes;
+		tree->capacity = (uint32_t)capacity;
+	}
+
+	new = &tree->nodes[tree->size];
+	new->n = value;
+	new->parent = parent;
+	new->balance = 0;
+	new->left = COMPACT_NIL;
+	new->right = COMPACT_NIL;
+
+	return (tree->size++);
+}
+
+/**
+ * compact_tree_height - Measures the height of an index-based subtree.
+ *
+ * @tree: A pointer to the tree.
+ * @node: The index of the root of the subtree.
+ *
+ * Return: The number of nodes on the longest path down from @node,
+ * 0 if @node is COMPACT_NIL.
+ */
+size_t compact_tree_height(const compact_tree_t *tree, uint32_t node)
+{
+	size_t height_left, height_right;
+
+	if (node == COMPACT_NIL)
+		return (0);
+
+	height_left = compact_tree_height(tree, tree->nodes[node].left);
+	height_right = compact_tree_height(tree, tree->nodes[node].right);
+
+	return ((height_left > height_right ? height_left : height_right) + 1);
+}
@@ -0,0 +1,66 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_compact - Prints an index-based tree in pre-order
+ *
+ * @tree: Pointer to the tree
+ * @node: Index of the node to print
+ */
+void print_compact(const compact_tree_t *tree, uint32_t node)
+{
+	if (node == COMPACT_NIL)
+	{
+		printf("-");
+		return;
+	}
+	printf("(%d ", tree->nodes[node].n);
+	print_compact(tree, tree->nodes[node].left);
+	printf(" ");
+	print_compact(tree, tree->nodes[node].right);
+	printf(")");
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	compact_tree_t *bst, *avl, *heap;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t i, n = sizeof(array) / sizeof(array[0]);
+
+	bst = compact_tree_create(0);
+	avl = compact_tree_create(4);
+	heap = compact_tree_create(0);
+	if (!bst || !avl || !heap)
+		return (1);
+	printf("Node size: %lu\n", (unsigned long)sizeof(compact_node_t));
+	for (i = 0; i < n; i++)
+	{
+		compact_bst_insert(bst, array[i]);
+		compact_avl_insert(avl, array[i]);
+		compact_heap_insert(heap, array[i]);
+	}
+	printf("Duplicate: %d\n", compact_bst_insert(bst, 68) == COMPACT_NIL);
+	print_compact(bst, bst->root);
+	printf("\n");
+	print_compact(avl, avl->root);
+	printf("\nAVL height: %lu\n",
+	       (unsigned long)compact_tree_height(avl, avl->root));
+	printf("Found 62: %d\n", avl->nodes[compact_bst_search(avl, 62)].n);
+	printf("Found 63: %d\n", compact_bst_search(avl, 63) != COMPACT_NIL);
+	while (heap->size)
+		printf("%d ", compact_heap_extract(heap));
+	printf("\n");
+	compact_tree_delete(bst);
+	compact_tree_delete(avl);
+	compact_tree_delete(heap);
+	return (0);
+}
@@ -0,0 +1,136 @@
+#include "binary_trees.h"
+
+/**
+ * relayout_measure - Measures the height and the size of a binary tree.
+ *
+ * @tree: A pointer to the root node of the tree.
+ * @size: A pointer to the counter to add the number of nodes to.
+ *
+ * Return: The number of levels of the tree, 0 if it is empty.
+ */
+size_t relayout_measure(const binary_tree_t *tree, size_t *size)
+{
+	size_t height_left, height_right;
+
+	if (!tree)
+		return (0);
+
+	(*size)++;
+	height_left = relayout_measure(tree->left, size);
+	height_right = relayout_measure(tree->right, size);
+
+	return ((height_left > height_right ? height_left : height_right) + 1);
+}
+
+/**
+ * relayout_bottoms - Lays out the bottom subtrees below a top subtree.
+ * The top subtree has already been copied, so its copy is walked along
+ * with the original to find the parent of each bottom subtree, which
+ * are then laid out from left to right.
+ *
+ * @tree: A pointer to a node of the original top subtree.
+ * @copy: A pointer to the copy of @tree.
+ * @depth: The number of levels of the top subtree left below @tree.
+ * @height: The number of levels of the bottom subtrees.
+ * @arena: A pointer to the arena to carve the copies from.
+ * @pos: A pointer to the number of nodes copied so far.
+ */
+void relayout_bottoms(const binary_tree_t *tree, binary_tree_t *copy,
+		      size_t depth, size_t height, tree_arena_t *arena,
+		      size_t *pos)
+{
+	if (!tree)
+		return;
+
+	if (depth > 1)
+	{
+		relayout_bottoms(tree->left, copy->left, depth - 1, height,
+				 arena, pos);
+		relayout_bottoms(tree->right, copy->right, depth - 1, height,
+				 arena, pos);
+		return;
+	}
+
+	copy->left = relayout_place(tree->left, height, copy, arena, pos);
+	copy->right = relayout_place(tree->right, height, copy, arena, pos);
+}
+
+/**
+ * relayout_place - Copies a subtree in van Emde Boas order.
+ * The subtree is cut at half its height: the top half is laid out first,
+ * then each of the bottom subtrees, every part being laid out the same
+ * way recursively. Any path from the root then crosses O(log n / log B)
+ * blocks of B nodes, whatever the cache line or page size B is.
+ *
+ * @tree: A pointer to the root node of the subtree to copy.
+ * @height: The number of levels of the subtree to lay out.
+ * @parent: A pointer to the copy of the parent of @tree.
+ * @arena: A pointer to the arena to carve the copies from.
+ * @pos: A pointer to the number of nodes copied so far.
+ *
+ * Return: A pointer to the copy of @tree, or NULL if @tree is NULL or
+ * on failure.
+ */
+binary_tree_t *relayout_place(const binary_tree_t *tree, size_t height,
+			      binary_tree_t *parent, tree_arena_t *arena,
+			      size_t *pos)
+{
+	binary_tree_t *copy;
+	size_t top;
+
+	if (!tree || height == 0)
+		return (NULL);
+
+	if (height == 1)
+	{
+		copy = tree_arena_carve(arena);
+		if (!copy)
+			return (NULL);
+		(*pos)++;
+		copy->n = tree->n;
+		copy->height = tree->height;
+		copy->in_arena = 1;
+		copy->parent = parent;
+		copy->left = NULL;
+		copy->right = NULL;
+		return (copy);
+	}
+
+	/* Lay out the top half, then the subtrees hanging below it */
+	top = height / 2;
+	copy = relayout_place(tree, top, parent, arena, pos);
+	if (copy)
+		relayout_bottoms(tree, copy, top, height - top, arena, pos);
+
+	return (copy);
+}
+
+/**
+ * binary_tree_relayout - Copies a binary tree into contiguous arena nodes.
+ * The nodes are carved one after the other from the slabs of @arena in
+ * van Emde Boas order so that searches on read-mostly trees touch few
+ * cache lines and pages. The original tree is left untouched.
+ * The copy is an ordinary arena tree: it can be modified, its nodes are
+ * recycled by the arena when removed, and it is released with
+ * tree_arena_release.
+ *
+ * @tree: A pointer to the root node of the tree to copy.
+ * @arena: A pointer to the arena to build the copy in.
+ *
+ * Return: A pointer to the root node of the copy, or NULL on failure.
+ */
+binary_tree_t *binary_tree_relayout(const binary_tree_t *tree,
+				    tree_arena_t *arena)
+{
+	binary_tree_t *copy;
+	size_t height, size = 0, pos = 0;
+
+	if (!tree || !arena)
+		return (NULL);
+
+	height = relayout_measure(tree, &size);
+	copy = relayout_place(tree, height, NULL, arena, &pos);
+
+	/* A failed copy is left in the arena until it is released */
+	return (pos == size ? copy : NULL);
+}
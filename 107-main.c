@@ -0,0 +1,40 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	bst_t *tree, *copy;
+	tree_arena_t *arena;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t i, n = sizeof(array) / sizeof(array[0]);
+
+	tree = array_to_bst(array, n);
+	arena = tree_arena_create(0);
+	if (!tree || !arena)
+		return (1);
+	copy = binary_tree_relayout(tree, arena);
+	if (!copy)
+		return (1);
+	binary_tree_print(copy);
+	printf("Layout:");
+	for (i = 0; i < n; i++)
+		printf(" %d", copy[i].n);
+	printf("\nFound: %d\n", bst_search(copy, 62)->n);
+
+	tree_arena_use(arena);
+	bst_insert(&copy, 100);
+	copy = bst_remove(copy, 79);
+	binary_tree_print(copy);
+	tree_arena_release(arena);
+	binary_tree_delete(tree);
+	return (0);
+}
@@ -76,7 +76,7 @@ int remove_node(bst_t *root)
 			root->parent->right = NULL;
 		else
 			root->parent->left = NULL;
-		free(root);
+		binary_tree_free(root);
 		return (0);
 	}
 	else if ((!root->left && root->right) || (!root->right && root->left))
@@ -97,7 +97,7 @@ int remove_node(bst_t *root)
 				root->parent->left = root->left;
 			root->left->parent = root->parent;
 		}
-		free(root);
+		binary_tree_free(root);
 		return (0);
 	}
 	else
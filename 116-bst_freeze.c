@@ -0,0 +1,136 @@
+#include "binary_trees.h"
+
+/**
+ * freeze_inorder - Copies the values of a BST into an array in order.
+ *
+ * @tree: A pointer to the root node of the BST.
+ * @array: A pointer to the destination array.
+ * @pos: A pointer to the index of the next free slot of @array.
+ */
+void freeze_inorder(const bst_t *tree, int *array, size_t *pos)
+{
+	if (!tree)
+		return;
+
+	freeze_inorder(tree->left, array, pos);
+	array[(*pos)++] = tree->n;
+	freeze_inorder(tree->right, array, pos);
+}
+
+/**
+ * freeze_eytzinger - Lays out a sorted array in Eytzinger order.
+ * Slot k of the index has its children at 2k and 2k + 1, so filling
+ * the slots with an in-order walk of that implicit tree places the
+ * sorted values in breadth-first order.
+ *
+ * @sorted: A pointer to the sorted values.
+ * @pos: A pointer to the index of the next value to place.
+ * @keys: A pointer to the 1-based Eytzinger array.
+ * @k: The slot of the implicit node to fill.
+ * @size: The number of values.
+ */
+void freeze_eytzinger(const int *sorted, size_t *pos, int *keys,
+		      size_t k, size_t size)
+{
+	if (k > size)
+		return;
+
+	freeze_eytzinger(sorted, pos, keys, 2 * k, size);
+	keys[k] = sorted[(*pos)++];
+	freeze_eytzinger(sorted, pos, keys, 2 * k + 1, size);
+}
+
+/**
+ * bst_freeze - Flattens a BST into a read-only Eytzinger search index.
+ * The values of the BST (or AVL tree) are stored breadth-first in one
+ * int array, a quarter of the size of the tree nodes, so the top levels
+ * share a few cache lines and the next levels can be prefetched.
+ * The array starts a 64-byte cache line, so slots 1 to 15 (the top four
+ * levels) share the first line and slots 16k to 16k + 15, the nodes four
+ * levels below slot k, share one line too.
+ * The index is a snapshot: it does not follow later updates of the tree.
+ *
+ * @tree: A pointer to the root node of the BST.
+ *
+ * Return: A pointer to the new index, or NULL on failure.
+ */
+frozen_index_t *bst_freeze(const bst_t *tree)
+{
+	frozen_index_t *index;
+	int *sorted;
+	size_t size, pos = 0;
+
+	if (!tree)
+		return (NULL);
+
+	size = binary_tree_size(tree);
+	index = malloc(sizeof(*index));
+	sorted = malloc(sizeof(*sorted) * size);
+	if (index && posix_memalign((void **)&index->keys, 64,
+				    sizeof(*index->keys) * (size + 1)))
+		index->keys = NULL;
+	if (!index || !sorted || !index->keys)
+	{
+		if (index)
+			free(index->keys);
+		free(index);
+		free(sorted);
+		return (NULL);
+	}
+
+	freeze_inorder(tree, sorted, &pos);
+	pos = 0;
+	freeze_eytzinger(sorted, &pos, index->keys, 1, size);
+	index->size = size;
+	free(sorted);
+
+	return (index);
+}
+
+/**
+ * frozen_index_delete - Deletes a frozen search index.
+ *
+ * @index: A pointer to the index to delete.
+ */
+void frozen_index_delete(frozen_index_t *index)
+{
+	if (!index)
+		return;
+
+	free(index->keys);
+	free(index);
+}
+
+/**
+ * frozen_search - Searches for a value in a frozen search index.
+ * The descent has no data-dependent branch: each step picks the child
+ * with a comparison result, and the slots four levels below are
+ * prefetched since they share one cache line.
+ * When the walk falls off the implicit tree, the trailing right turns
+ * are undone to find the smallest value not less than @value.
+ *
+ * @index: A pointer to the index.
+ * @value: The value to search for.
+ *
+ * Return: A pointer to the value in the index if found, or NULL otherwise.
+ */
+const int *frozen_search(const frozen_index_t *index, int value)
+{
+	const int *keys;
+	size_t k = 1;
+
+	if (!index)
+		return (NULL);
+
+	keys = index->keys;
+	while (k <= index->size)
+	{
+		__builtin_prefetch(keys + k * FROZEN_PREFETCH_STRIDE);
+		k = 2 * k + (keys[k] < value);
+	}
+	k >>= __builtin_ffsl((long)~k);
+
+	if (k == 0 || keys[k] != value)
+		return (NULL);
+	return (keys + k);
+}
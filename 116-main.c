@@ -0,0 +1,47 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	avl_t *tree;
+	frozen_index_t *index;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t i, n = sizeof(array) / sizeof(array[0]);
+	const int *found;
+
+	tree = array_to_avl(array, n);
+	if (!tree)
+		return (1);
+	binary_tree_print(tree);
+	index = bst_freeze(tree);
+	if (!index)
+		return (1);
+	printf("Index:");
+	for (i = 1; i <= index->size; i++)
+		printf(" %d", index->keys[i]);
+	printf("\n");
+	for (i = 0; i < n; i++)
+	{
+		found = frozen_search(index, array[i]);
+		if (!found || *found != array[i])
+			return (1);
+	}
+	found = frozen_search(index, 32);
+	printf("Found: %d\n", *found);
+	found = frozen_search(index, 512);
+	printf("Should be nil -> %p\n", (void *)found);
+	found = frozen_search(index, 0);
+	printf("Should be nil -> %p\n", (void *)found);
+	frozen_index_delete(index);
+	binary_tree_delete(tree);
+	return (0);
+}
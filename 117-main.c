@@ -0,0 +1,45 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	bst_t *tree;
+	stree_t *stree;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95, 3, 5, 7, 11,
+		13, 17, 19, 23, 29, 31, 37, 41, 43, 53,
+		59, 61, 67, 71, 73, 83, 89, 97, INT_MAX - 1
+	};
+	size_t i, n = sizeof(array) / sizeof(array[0]);
+	const int *found;
+
+	tree = array_to_bst(array, n);
+	if (!tree)
+		return (1);
+	stree = bst_to_stree(tree);
+	if (!stree)
+		return (1);
+	printf("Blocks: %lu\n", (unsigned long)stree->blocks);
+	for (i = 0; i < n; i++)
+	{
+		found = stree_search(stree, array[i]);
+		if (!found || *found != array[i])
+			return (1);
+	}
+	found = stree_search(stree, 32);
+	printf("Found: %d\n", *found);
+	found = stree_search(stree, 4);
+	printf("Should be nil -> %p\n", (void *)found);
+	found = stree_search(stree, INT_MAX);
+	printf("Should be nil -> %p\n", (void *)found);
+	stree_delete(stree);
+	binary_tree_delete(tree);
+	return (0);
+}
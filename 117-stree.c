@@ -0,0 +1,110 @@
+#include "binary_trees.h"
+
+/**
+ * stree_build - Fills the nodes of a static search tree in order.
+ * Node k has its STREE_B + 1 children at k * (STREE_B + 1) + i + 1,
+ * so walking that implicit tree in order and taking the sorted values
+ * one by one stores them in B-tree order. Slots left past the last
+ * value are padded with INT_MAX.
+ *
+ * @tree: A pointer to the static search tree being built.
+ * @sorted: A pointer to the sorted values.
+ * @pos: A pointer to the index of the next value to place.
+ * @k: The node to fill.
+ */
+void stree_build(stree_t *tree, const int *sorted, size_t *pos, size_t k)
+{
+	size_t i;
+
+	if (k >= tree->blocks)
+		return;
+
+	for (i = 0; i < STREE_B; i++)
+	{
+		stree_build(tree, sorted, pos, k * (STREE_B + 1) + i + 1);
+		if (*pos < tree->size)
+			tree->keys[k * STREE_B + i] = sorted[(*pos)++];
+		else
+			tree->keys[k * STREE_B + i] = INT_MAX;
+	}
+	stree_build(tree, sorted, pos, k * (STREE_B + 1) + STREE_B + 1);
+}
+
+/**
+ * sorted_array_to_stree - Builds a static search tree from a sorted array.
+ * Each node holds STREE_B keys in one 64-byte cache line and is searched
+ * with a single SIMD comparison, so a lookup visits about four times
+ * fewer levels than a binary search tree.
+ *
+ * @array: A pointer to the sorted array of distinct integers.
+ * @size: The number of elements in the array.
+ *
+ * Return: A pointer to the new static search tree, or NULL on failure.
+ */
+stree_t *sorted_array_to_stree(const int *array, size_t size)
+{
+	stree_t *tree;
+	size_t pos = 0;
+
+	if (!array || size == 0)
+		return (NULL);
+
+	tree = malloc(sizeof(*tree));
+	if (!tree)
+		return (NULL);
+	tree->size = size;
+	tree->blocks = (size + STREE_B - 1) / STREE_B;
+	tree->max = array[size - 1];
+	if (posix_memalign((void **)&tree->keys, 64,
+			   sizeof(*tree->keys) * STREE_B * tree->blocks))
+	{
+		free(tree);
+		return (NULL);
+	}
+
+	stree_build(tree, array, &pos, 0);
+
+	return (tree);
+}
+
+/**
+ * bst_to_stree - Builds a static search tree from the values of a BST.
+ *
+ * @tree: A pointer to the root node of the BST or AVL tree.
+ *
+ * Return: A pointer to the new static search tree, or NULL on failure.
+ */
+stree_t *bst_to_stree(const bst_t *tree)
+{
+	stree_t *stree;
+	int *sorted;
+	size_t size, pos = 0;
+
+	if (!tree)
+		return (NULL);
+
+	size = binary_tree_size(tree);
+	sorted = malloc(sizeof(*sorted) * size);
+	if (!sorted)
+		return (NULL);
+
+	freeze_inorder(tree, sorted, &pos);
+	stree = sorted_array_to_stree(sorted, size);
+	free(sorted);
+
+	return (stree);
+}
+
+/**
+ * stree_delete - Deletes a static search tree.
+ *
+ * @tree: A pointer to the static search tree to delete.
+ */
+void stree_delete(stree_t *tree)
+{
+	if (!tree)
+		return;
+
+	free(tree->keys);
+	free(tree);
+}
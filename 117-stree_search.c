@@ -0,0 +1,80 @@
+#include "binary_trees.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * stree_node_rank - Counts the keys of a node lower than a value.
+ * The keys of a node are sorted, so the count is also the index of the
+ * first key not lower than @value. It uses two AVX2 comparisons when
+ * available, four SSE2 ones otherwise, and a plain loop as a last resort.
+ *
+ * @keys: A pointer to the STREE_B keys of the node, 64-byte aligned.
+ * @value: The value to compare the keys to.
+ *
+ * Return: The number of keys lower than @value.
+ */
+unsigned int stree_node_rank(const int *keys, int value)
+{
+#if defined(__AVX2__)
+	const __m256i *lines = (const __m256i *)keys;
+	__m256i x = _mm256_set1_epi32(value);
+	__m256i lo = _mm256_cmpgt_epi32(x, _mm256_load_si256(lines));
+	__m256i hi = _mm256_cmpgt_epi32(x, _mm256_load_si256(lines + 1));
+	unsigned int mask = _mm256_movemask_ps(_mm256_castsi256_ps(lo)) |
+		_mm256_movemask_ps(_mm256_castsi256_ps(hi)) << 8;
+
+	return (__builtin_popcount(mask));
+#elif defined(__SSE2__)
+	__m128i x = _mm_set1_epi32(value);
+	const __m128i *lines = (const __m128i *)keys;
+	unsigned int mask = 0, i;
+	__m128i lt;
+
+	for (i = 0; i < STREE_B / 4; i++)
+	{
+		lt = _mm_cmpgt_epi32(x, _mm_load_si128(lines + i));
+		mask |= _mm_movemask_ps(_mm_castsi128_ps(lt)) << (4 * i);
+	}
+
+	return (__builtin_popcount(mask));
+#else
+	unsigned int i, rank = 0;
+
+	for (i = 0; i < STREE_B; i++)
+		rank += keys[i] < value;
+
+	return (rank);
+#endif
+}
+
+/**
+ * stree_search - Searches for a value in a static search tree.
+ *
+ * @tree: A pointer to the static search tree.
+ * @value: The value to search for.
+ *
+ * Return: A pointer to the value in the tree if found, or NULL otherwise.
+ */
+const int *stree_search(const stree_t *tree, int value)
+{
+	const int *keys;
+	size_t k = 0;
+	unsigned int i;
+
+	/* Rule out values above the maximum, the padding included */
+	if (!tree || value > tree->max)
+		return (NULL);
+
+	while (k < tree->blocks)
+	{
+		keys = tree->keys + k * STREE_B;
+		i = stree_node_rank(keys, value);
+		if (i < STREE_B && keys[i] == value)
+			return (keys + i);
+		k = k * (STREE_B + 1) + i + 1;
+	}
+
+	return (NULL);
+}
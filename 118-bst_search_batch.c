@@ -0,0 +1,80 @@
+#include "binary_trees.h"
+
+/**
+ * bst_batch_step - Advances one in-flight search by one level.
+ * The next node is prefetched and not read before the next round, so
+ * its cache miss overlaps with the steps of the other searches.
+ *
+ * @cursor: A pointer to the current node of the search.
+ * @value: The value searched for.
+ *
+ * Return: 1 if the search is over (value found or subtree empty),
+ * 0 if it moved one level down.
+ */
+int bst_batch_step(const bst_t **cursor, int value)
+{
+	const bst_t *node = *cursor;
+
+	if (!node || node->n == value)
+		return (1);
+
+	node = value < node->n ? node->left : node->right;
+	if (node)
+		__builtin_prefetch(node);
+	*cursor = node;
+
+	return (0);
+}
+
+/**
+ * bst_search_batch - Searches for many values in a BST at once.
+ * Up to BST_BATCH_WIDTH searches are kept in flight and advanced in
+ * turns, one level each, a finished search handing its slot to the next
+ * key. Memory latency is then paid once per round instead of once per
+ * level of every search. Works on AVL trees as well.
+ *
+ * @tree: A pointer to the root node of the BST.
+ * @keys: A pointer to the values to search for.
+ * @n: The number of values.
+ * @out: A pointer to an array of @n results, each set to the node holding
+ * the matching value or to NULL if the value is not in the tree.
+ *
+ * Return: The number of values found.
+ */
+size_t bst_search_batch(const bst_t *tree, const int *keys, size_t n,
+			bst_t **out)
+{
+	const bst_t *cursor[BST_BATCH_WIDTH];
+	size_t query[BST_BATCH_WIDTH];
+	size_t j, next = 0, active = 0, hits = 0;
+
+	if (!keys || !out)
+		return (0);
+
+	/* Start the first searches, slots left empty hold n */
+	for (j = 0; j < BST_BATCH_WIDTH; j++)
+	{
+		cursor[j] = tree;
+		query[j] = next < n ? next++ : n;
+		active += query[j] < n;
+	}
+
+	while (active)
+	{
+		for (j = 0; j < BST_BATCH_WIDTH; j++)
+		{
+			if (query[j] == n)
+				continue;
+			if (!bst_batch_step(&cursor[j], keys[query[j]]))
+				continue;
+			/* Record the result and reuse the slot */
+			out[query[j]] = (bst_t *)cursor[j];
+			hits += cursor[j] != NULL;
+			cursor[j] = tree;
+			query[j] = next < n ? next++ : n;
+			active -= query[j] == n;
+		}
+	}
+
+	return (hits);
+}
@@ -0,0 +1,43 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	avl_t *tree;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	int keys[] = {
+		32, 512, 1, 98, 0, 62, 33, 79, 47, 68,
+		87, 84, 91, 21, 32, 34, 2, 20, 22, 95,
+		-1, 100
+	};
+	size_t i, hits, n = sizeof(array) / sizeof(array[0]);
+	size_t k = sizeof(keys) / sizeof(keys[0]);
+	bst_t *out[sizeof(keys) / sizeof(keys[0])];
+
+	tree = array_to_avl(array, n);
+	if (!tree)
+		return (1);
+	binary_tree_print(tree);
+	hits = bst_search_batch(tree, keys, k, out);
+	printf("Hits: %lu\n", (unsigned long)hits);
+	for (i = 0; i < k; i++)
+	{
+		if (out[i] != bst_search(tree, keys[i]))
+			return (1);
+		if (out[i])
+			printf("%d: found %d\n", keys[i], out[i]->n);
+		else
+			printf("%d: not found\n", keys[i]);
+	}
+	binary_tree_delete(tree);
+	return (0);
+}
@@ -28,8 +28,8 @@ avl_t *create_balanced_avl(avl_t *parent, int *array, int start, int end)
 	if (start > end)
 		return (NULL);
 
-	/* Calculate the index of the middle element */
-	middle = (start + end) / 2;
+	/* Calculate the index of the middle element, without overflowing */
+	middle = start + (end - start) / 2;
 
 	/* Create a new node using the middle element as the value */
 	x = binary_tree_node((binary_tree_t *)parent, array[middle]);
@@ -45,6 +45,10 @@ avl_t *create_balanced_avl(avl_t *parent, int *array, int start, int end)
 	/* Recursively create the right subtree */
 	root->right = create_balanced_avl(root, array, middle + 1, end);
 
+	/* Store the height, the right subtree is never the shorter one */
+	if (root->right)
+		root->height = root->right->height + 1;
+
 	return (root);
 }
 
@@ -60,14 +64,14 @@ avl_t *create_balanced_avl(avl_t *parent, int *array, int start, int end)
  * using the `x_sort` function.
  *
  * @array: A pointer to the sorted array of integers.
- * @size: The number of elements in the array.
+ * @size: The number of elements in the array, at most INT_MAX.
  *
  * Return: A pointer to the root node of the created AVL tree,
  * or NULL if the array is empty or invalid.
  */
 avl_t *sorted_array_to_avl(int *array, size_t size)
 {
-	if (array == NULL || size == 0)
+	if (array == NULL || size == 0 || size > INT_MAX)
 		return (NULL);
 
 	/* Call xiliary function to recursively construct the AVL tree */
@@ -0,0 +1,62 @@
+#include "binary_trees.h"
+
+/**
+ * avl_height - Returns the stored height of an AVL subtree.
+ *
+ * @tree: A pointer to the root of the subtree, may be NULL.
+ *
+ * Return: The height of the subtree, 0 if it is empty.
+ */
+int avl_height(const avl_t *tree)
+{
+	return (tree ? tree->height : 0);
+}
+
+/**
+ * avl_update_height - Recomputes the stored height of a node in O(1).
+ * The heights of its children must be up to date.
+ *
+ * @node: A pointer to the node.
+ */
+void avl_update_height(avl_t *node)
+{
+	int left = avl_height(node->left), right = avl_height(node->right);
+
+	node->height = (left > right ? left : right) + 1;
+}
+
+/**
+ * avl_cached_rebalance - Restores the balance of a node from stored heights.
+ * The balance factor is read from the heights of the two children, so
+ * nothing below them is visited. The node is rotated when its subtrees
+ * differ in height by two, the rotations fixing the heights they change,
+ * otherwise only its own height is refreshed.
+ *
+ * @node: A pointer to the node, whose children must be balanced.
+ *
+ * Return: A pointer to the root of the subtree after rebalancing.
+ */
+avl_t *avl_cached_rebalance(avl_t *node)
+{
+	int balance = avl_height(node->left) - avl_height(node->right);
+
+	if (balance > 1)
+	{
+		/* Left-right case: straighten the left subtree first */
+		if (avl_height(node->left->left) <
+		    avl_height(node->left->right))
+			binary_tree_rotate_left(node->left);
+		return (binary_tree_rotate_right(node));
+	}
+	if (balance < -1)
+	{
+		/* Right-left case: straighten the right subtree first */
+		if (avl_height(node->right->right) <
+		    avl_height(node->right->left))
+			binary_tree_rotate_right(node->right);
+		return (binary_tree_rotate_left(node));
+	}
+	avl_update_height(node);
+
+	return (node);
+}
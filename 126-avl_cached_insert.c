@@ -0,0 +1,93 @@
+#include "binary_trees.h"
+
+/**
+ * avl_cached_retrace - Rebalances the path from a node up to the root.
+ * Each node of the path is rebalanced from the stored heights of its
+ * children in O(1). The walk stops as soon as a subtree ends up with the
+ * height it had before, since nothing above it can have changed.
+ *
+ * @tree: A double pointer to the root node of the AVL tree.
+ * @node: A pointer to the lowest node whose subtree changed, may be NULL.
+ */
+void avl_cached_retrace(avl_t **tree, avl_t *node)
+{
+	int height;
+
+	while (node)
+	{
+		height = node->height;
+		node = avl_cached_rebalance(node);
+		if (!node->parent)
+			*tree = node;
+		if (node->height == height)
+			break;
+		node = node->parent;
+	}
+}
+
+/**
+ * avl_cached_insert - Inserts a value into an AVL tree in O(log n).
+ * This is the implementation behind avl_insert: the value is inserted as
+ * in a BST, then only its path is retraced, each balance factor being
+ * read from the stored heights instead of measuring the subtrees.
+ *
+ * @tree: A double pointer to the root node of the AVL tree.
+ * @value: The value to insert.
+ *
+ * Return: A pointer to the new node, or NULL if the value already
+ * exists or on failure.
+ */
+avl_t *avl_cached_insert(avl_t **tree, int value)
+{
+	avl_t *parent = NULL, **link, *new;
+
+	if (!tree)
+		return (NULL);
+
+	for (link = tree; *link; link = value < parent->n ?
+		     &parent->left : &parent->right)
+	{
+		parent = *link;
+		if (parent->n == value)
+			return (NULL);
+	}
+	new = binary_tree_node(parent, value);
+	if (!new)
+		return (NULL);
+	*link = new;
+	avl_cached_retrace(tree, parent);
+
+	return (new);
+}
+
+/**
+ * array_to_avl_cached - Builds an AVL tree from an array in O(n log n).
+ * This is the implementation behind array_to_avl: duplicate values are
+ * ignored and each insertion costs O(log n).
+ *
+ * @array: A pointer to the array of integers.
+ * @size: The number of elements in the array.
+ *
+ * Return: A pointer to the root node of the AVL tree, or NULL on failure.
+ */
+avl_t *array_to_avl_cached(int *array, size_t size)
+{
+	avl_t *root = NULL;
+	size_t i;
+
+	if (!array || size == 0)
+		return (NULL);
+
+	for (i = 0; i < size; i++)
+	{
+		/* A failed insertion is a duplicate if the value is there */
+		if (!avl_cached_insert(&root, array[i]) &&
+		    !bst_search(root, array[i]))
+		{
+			binary_tree_delete(root);
+			return (NULL);
+		}
+	}
+
+	return (root);
+}
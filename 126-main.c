@@ -0,0 +1,34 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	avl_t *tree;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t n = sizeof(array) / sizeof(array[0]);
+
+	tree = array_to_avl_cached(array, n);
+	if (!tree)
+		return (1);
+	binary_tree_print(tree);
+	printf("Height: %d, is AVL: %d\n", avl_height(tree),
+	       binary_tree_is_avl(tree));
+	printf("Duplicate: %p\n", (void *)avl_cached_insert(&tree, 68));
+	avl_cached_insert(&tree, 23);
+	avl_cached_insert(&tree, 24);
+	avl_cached_insert(&tree, 25);
+	binary_tree_print(tree);
+	printf("Height: %d, is AVL: %d\n", avl_height(tree),
+	       binary_tree_is_avl(tree));
+	binary_tree_delete(tree);
+	return (0);
+}
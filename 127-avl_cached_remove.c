@@ -0,0 +1,62 @@
+#include "binary_trees.h"
+
+/**
+ * avl_cached_unlink - Takes a node with at most one child out of a tree.
+ * Its child, if any, takes its place under its parent.
+ *
+ * @tree: A double pointer to the root node of the tree.
+ * @node: A pointer to the node to unlink, which is then freed.
+ *
+ * Return: A pointer to the parent of the node, NULL if it was the root.
+ */
+avl_t *avl_cached_unlink(avl_t **tree, avl_t *node)
+{
+	avl_t *parent = node->parent;
+	avl_t *child = node->left ? node->left : node->right;
+
+	if (child)
+		child->parent = parent;
+	if (!parent)
+		*tree = child;
+	else if (parent->left == node)
+		parent->left = child;
+	else
+		parent->right = child;
+	binary_tree_free(node);
+
+	return (parent);
+}
+
+/**
+ * avl_cached_remove - Removes a value from an AVL tree in O(log n).
+ * This is the implementation behind avl_remove. A node with two children
+ * takes the value of its in-order successor, which is removed instead.
+ * Only the path from the parent of the removed node up to the root is
+ * then retraced, with single or double rotations where needed, until a
+ * subtree keeps its height. The root is removed like any other node.
+ *
+ * @root: A pointer to the root node of the AVL tree.
+ * @value: The value to remove.
+ *
+ * Return: A pointer to the new root node of the tree after removal.
+ */
+avl_t *avl_cached_remove(avl_t *root, int value)
+{
+	avl_t *node = root, *successor;
+
+	while (node && node->n != value)
+		node = value < node->n ? node->left : node->right;
+	if (!node)
+		return (root);
+
+	if (node->left && node->right)
+	{
+		for (successor = node->right; successor->left;)
+			successor = successor->left;
+		node->n = successor->n;
+		node = successor;
+	}
+	avl_cached_retrace(&root, avl_cached_unlink(&root, node));
+
+	return (root);
+}
@@ -0,0 +1,53 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * elapsed - Returns the seconds elapsed since a given clock value
+ *
+ * @start: The clock value to measure from
+ *
+ * Return: The elapsed time in seconds
+ */
+double elapsed(clock_t start)
+{
+	return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * main - Benchmarks avl_remove by emptying a tree one value at a time,
+ * from 1K values up to the size given as argument (default 10M),
+ * multiplying by 10 at each step
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments, argv[1] being the largest size to run
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int argc, char **argv)
+{
+	size_t i, n, max = argc > 1 ? strtoul(argv[1], NULL, 10) : 10000000;
+	clock_t start;
+	avl_t *tree;
+	int *keys;
+
+	keys = malloc(sizeof(*keys) * max);
+	if (!keys)
+		return (1);
+	srand(98);
+	for (i = 0; i < max; i++)
+		keys[i] = rand();
+	for (n = 1000; n <= max; n *= 10)
+	{
+		tree = array_to_avl(keys, n);
+		start = clock();
+		for (i = n; i > 0; i--)
+			tree = avl_remove(tree, keys[i - 1]);
+		printf("%lu values: avl_remove %.3fs, %s\n", (unsigned long)n,
+		       elapsed(start), tree ? "not empty" : "empty");
+		binary_tree_delete(tree);
+	}
+	free(keys);
+	return (0);
+}
@@ -0,0 +1,34 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	avl_t *tree;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95};
+	int removed[] = {47, 79, 32, 34, 22, 63};
+	size_t i, n = sizeof(array) / sizeof(array[0]);
+
+	tree = array_to_avl_cached(array, n);
+	if (!tree)
+		return (1);
+	binary_tree_print(tree);
+
+	for (i = 0; i < sizeof(removed) / sizeof(removed[0]); i++)
+	{
+		tree = avl_cached_remove(tree, removed[i]);
+		printf("Removed %d...\n", removed[i]);
+		binary_tree_print(tree);
+		printf("Height: %d, is AVL: %d\n", avl_height(tree),
+		       binary_tree_is_avl(tree));
+	}
+	binary_tree_delete(tree);
+	return (0);
+}
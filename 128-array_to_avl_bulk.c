@@ -0,0 +1,104 @@
+#include "binary_trees.h"
+
+/**
+ * radix_sort_int - Sorts an array of integers in O(n) with a radix sort.
+ * The values are sorted one byte at a time, least significant first,
+ * with a stable counting pass each. The sign bit is flipped so negative
+ * values come first. All four histograms are counted in a single read,
+ * and a byte shared by every value is skipped.
+ *
+ * @array: A pointer to the array to sort.
+ * @size: The number of values in the array.
+ * @scratch: A pointer to a buffer of @size values.
+ */
+void radix_sort_int(int *array, size_t size, int *scratch)
+{
+	size_t counts[4][256], i, pass, sum, count;
+	int *from = array, *to = scratch, *swap;
+	unsigned int key, shift;
+
+	if (!array || size < 2)
+		return;
+
+	memset(counts, 0, sizeof(counts));
+	for (i = 0; i < size; i++)
+	{
+		key = (unsigned int)array[i] ^ 0x80000000u;
+		for (pass = 0; pass < 4; pass++)
+			counts[pass][(key >> (8 * pass)) & 0xFF]++;
+	}
+	for (pass = 0, shift = 0; pass < 4; pass++, shift += 8)
+	{
+		key = (unsigned int)array[0] ^ 0x80000000u;
+		if (counts[pass][(key >> shift) & 0xFF] == size)
+			continue;
+		for (i = 0, sum = 0; i < 256; i++)
+		{
+			count = counts[pass][i];
+			counts[pass][i] = sum;
+			sum += count;
+		}
+		for (i = 0; i < size; i++)
+		{
+			key = (unsigned int)from[i] ^ 0x80000000u;
+			to[counts[pass][(key >> shift) & 0xFF]++] = from[i];
+		}
+		swap = from, from = to, to = swap;
+	}
+	if (from != array)
+		memcpy(array, from, sizeof(*array) * size);
+}
+
+/**
+ * sorted_array_unique - Removes the duplicates of a sorted array in place.
+ *
+ * @array: A pointer to the sorted array.
+ * @size: The number of values in the array.
+ *
+ * Return: The number of distinct values, now at the start of the array.
+ */
+size_t sorted_array_unique(int *array, size_t size)
+{
+	size_t i, unique = 0;
+
+	for (i = 0; i < size; i++)
+		if (unique == 0 || array[i] != array[unique - 1])
+			array[unique++] = array[i];
+
+	return (unique);
+}
+
+/**
+ * array_to_avl_bulk - Builds an AVL tree from an unsorted array in O(n).
+ * This is the bulk counterpart of array_to_avl: instead of a duplicate
+ * scan and a rebalancing insertion per value, a copy of the array is
+ * radix sorted, deduplicated in one pass and handed to
+ * create_balanced_avl, which builds a perfectly balanced tree with its
+ * heights stored. The tree holds the same values as the one built by
+ * array_to_avl, but its shape may differ.
+ *
+ * @array: A pointer to the array of integers.
+ * @size: The number of elements in the array, at most INT_MAX.
+ *
+ * Return: A pointer to the root node of the AVL tree, or NULL on failure.
+ */
+avl_t *array_to_avl_bulk(int *array, size_t size)
+{
+	avl_t *tree;
+	int *keys;
+
+	if (!array || size == 0 || size > INT_MAX)
+		return (NULL);
+
+	keys = malloc(sizeof(*keys) * size * 2);
+	if (!keys)
+		return (NULL);
+
+	memcpy(keys, array, sizeof(*array) * size);
+	radix_sort_int(keys, size, keys + size);
+	size = sorted_array_unique(keys, size);
+	tree = create_balanced_avl(NULL, keys, 0, (int)size - 1);
+	free(keys);
+
+	return (tree);
+}
@@ -0,0 +1,64 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * elapsed - Returns the seconds elapsed since a given clock value
+ *
+ * @start: The clock value to measure from
+ *
+ * Return: The elapsed time in seconds
+ */
+double elapsed(clock_t start)
+{
+	return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * main - Benchmarks array_to_avl against array_to_avl_bulk from 1K values
+ * up to the size given as argument (default 50M), multiplying by 10 at
+ * each step and ending with the size itself. array_to_avl only runs up
+ * to 10M values
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments, argv[1] being the largest size to run
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int argc, char **argv)
+{
+	size_t i, n, max = argc > 1 ? strtoul(argv[1], NULL, 10) : 50000000;
+	clock_t start;
+	avl_t *tree;
+	int *keys;
+
+	keys = malloc(sizeof(*keys) * max);
+	if (!keys)
+		return (1);
+	srand(98);
+	for (i = 0; i < max; i++)
+		keys[i] = rand();
+	for (n = 1000; ; n *= 10)
+	{
+		if (n > max)
+			n = max;
+		printf("%lu values\n", (unsigned long)n);
+		if (n <= 10000000)
+		{
+			start = clock();
+			tree = array_to_avl(keys, n);
+			printf("  array_to_avl:      %.3fs\n", elapsed(start));
+			binary_tree_delete(tree);
+		}
+		start = clock();
+		tree = array_to_avl_bulk(keys, n);
+		printf("  array_to_avl_bulk: %.3fs, height %d\n",
+		       elapsed(start), avl_height(tree));
+		binary_tree_delete(tree);
+		if (n == max)
+			break;
+	}
+	free(keys);
+	return (0);
+}
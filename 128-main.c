@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	avl_t *tree;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95, -5, 68, 21, -98
+	};
+	size_t n = sizeof(array) / sizeof(array[0]);
+
+	tree = array_to_avl_bulk(array, n);
+	if (!tree)
+		return (1);
+	binary_tree_print(tree);
+	printf("Height: %d, is AVL: %d\n", avl_height(tree),
+	       binary_tree_is_avl(tree));
+	avl_cached_insert(&tree, 99);
+	avl_cached_insert(&tree, 100);
+	tree = avl_cached_remove(tree, 2);
+	printf("Height: %d, is AVL: %d\n", avl_height(tree),
+	       binary_tree_is_avl(tree));
+	binary_tree_delete(tree);
+	return (0);
+}
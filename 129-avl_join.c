@@ -0,0 +1,135 @@
+#include "binary_trees.h"
+
+/**
+ * avl_expose - Detaches a node from its children.
+ * The node and both subtrees come out as separate trees.
+ *
+ * @node: A pointer to the node, whose parent link is also cleared.
+ * @left: A pointer to a variable to store the left subtree in.
+ * @right: A pointer to a variable to store the right subtree in.
+ *
+ * Return: A pointer to the node.
+ */
+avl_t *avl_expose(avl_t *node, avl_t **left, avl_t **right)
+{
+	*left = node->left;
+	*right = node->right;
+	if (*left)
+		(*left)->parent = NULL;
+	if (*right)
+		(*right)->parent = NULL;
+	node->parent = node->left = node->right = NULL;
+	node->height = 1;
+
+	return (node);
+}
+
+/**
+ * avl_join_right - Joins a shorter tree on the right spine of a taller one.
+ * The spine of @left is followed down to the first subtree no taller than
+ * @right plus one, which is replaced with @node holding both, then the
+ * path back up is retraced.
+ *
+ * @left: A pointer to the root of the taller tree.
+ * @node: A pointer to a detached node, greater than @left.
+ * @right: A pointer to the root of the shorter tree, greater than @node.
+ *
+ * Return: A pointer to the root of the joined tree.
+ */
+avl_t *avl_join_right(avl_t *left, avl_t *node, avl_t *right)
+{
+	avl_t *spine = left, *root = left;
+
+	while (avl_height(spine->right) > avl_height(right) + 1)
+		spine = spine->right;
+	node->left = spine->right;
+	node->right = right;
+	if (node->left)
+		node->left->parent = node;
+	if (right)
+		right->parent = node;
+	avl_update_height(node);
+	spine->right = node;
+	node->parent = spine;
+	avl_cached_retrace(&root, spine);
+
+	return (root);
+}
+
+/**
+ * avl_join_left - Joins a shorter tree on the left spine of a taller one.
+ *
+ * @left: A pointer to the root of the shorter tree.
+ * @node: A pointer to a detached node, greater than @left.
+ * @right: A pointer to the root of the taller tree, greater than @node.
+ *
+ * Return: A pointer to the root of the joined tree.
+ */
+avl_t *avl_join_left(avl_t *left, avl_t *node, avl_t *right)
+{
+	avl_t *spine = right, *root = right;
+
+	while (avl_height(spine->left) > avl_height(left) + 1)
+		spine = spine->left;
+	node->right = spine->left;
+	node->left = left;
+	if (node->right)
+		node->right->parent = node;
+	if (left)
+		left->parent = node;
+	avl_update_height(node);
+	spine->left = node;
+	node->parent = spine;
+	avl_cached_retrace(&root, spine);
+
+	return (root);
+}
+
+/**
+ * avl_join_node - Joins two AVL trees around a node in O(|h1 - h2| + 1).
+ *
+ * @left: A pointer to the root of the lower tree, may be NULL.
+ * @node: A pointer to a detached node, between the two trees.
+ * @right: A pointer to the root of the greater tree, may be NULL.
+ *
+ * Return: A pointer to the root of the joined tree.
+ */
+avl_t *avl_join_node(avl_t *left, avl_t *node, avl_t *right)
+{
+	if (avl_height(left) > avl_height(right) + 1)
+		return (avl_join_right(left, node, right));
+	if (avl_height(right) > avl_height(left) + 1)
+		return (avl_join_left(left, node, right));
+
+	node->parent = NULL;
+	node->left = left;
+	node->right = right;
+	if (left)
+		left->parent = node;
+	if (right)
+		right->parent = node;
+	avl_update_height(node);
+
+	return (node);
+}
+
+/**
+ * avl_join - Joins two AVL trees around a new key.
+ * Every value of @left must be lower than @key and every value of
+ * @right greater. Both trees are consumed.
+ *
+ * @left: A pointer to the root of the lower tree, may be NULL.
+ * @key: The value to put between the two trees.
+ * @right: A pointer to the root of the greater tree, may be NULL.
+ *
+ * Return: A pointer to the root of the joined tree, or NULL on failure.
+ */
+avl_t *avl_join(avl_t *left, int key, avl_t *right)
+{
+	avl_t *node = binary_tree_node(NULL, key);
+
+	if (!node)
+		return (NULL);
+
+	return (avl_join_node(left, node, right));
+}
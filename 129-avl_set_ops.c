@@ -0,0 +1,97 @@
+#include "binary_trees.h"
+
+/**
+ * avl_union - Merges two AVL trees into the union of their values.
+ * The second tree is split around the root of the first, the halves are
+ * merged recursively and joined back around that root, which takes
+ * O(m log(n / m + 1)) for trees of sizes m <= n instead of m insertions.
+ * Both trees are consumed, their nodes are reused and duplicates freed.
+ *
+ * @a: A pointer to the root of the first tree, may be NULL.
+ * @b: A pointer to the root of the second tree, may be NULL.
+ *
+ * Return: A pointer to the root of the union.
+ */
+avl_t *avl_union(avl_t *a, avl_t *b)
+{
+	avl_t *a_left, *a_right, *b_left, *b_right, *duplicate;
+
+	if (!a)
+		return (b);
+	if (!b)
+		return (a);
+
+	avl_expose(a, &a_left, &a_right);
+	duplicate = avl_split(b, a->n, &b_left, &b_right);
+	binary_tree_free(duplicate);
+
+	return (avl_join_node(avl_union(a_left, b_left), a,
+			      avl_union(a_right, b_right)));
+}
+
+/**
+ * avl_intersect - Reduces two AVL trees to the values found in both.
+ * It follows avl_union, the root of the first tree being kept only if
+ * the split of the second one finds it. Both trees are consumed and the
+ * nodes left out are freed.
+ *
+ * @a: A pointer to the root of the first tree, may be NULL.
+ * @b: A pointer to the root of the second tree, may be NULL.
+ *
+ * Return: A pointer to the root of the intersection.
+ */
+avl_t *avl_intersect(avl_t *a, avl_t *b)
+{
+	avl_t *a_left, *a_right, *b_left, *b_right, *duplicate;
+	avl_t *left, *right;
+
+	if (!a || !b)
+	{
+		binary_tree_delete(a);
+		binary_tree_delete(b);
+		return (NULL);
+	}
+
+	avl_expose(a, &a_left, &a_right);
+	duplicate = avl_split(b, a->n, &b_left, &b_right);
+	left = avl_intersect(a_left, b_left);
+	right = avl_intersect(a_right, b_right);
+	if (!duplicate)
+	{
+		binary_tree_free(a);
+		return (avl_join2(left, right));
+	}
+	binary_tree_free(duplicate);
+
+	return (avl_join_node(left, a, right));
+}
+
+/**
+ * avl_difference - Removes from an AVL tree the values of another one.
+ * The first tree is split around the root of the second, and the halves
+ * are reduced recursively then joined back without that root. Both
+ * trees are consumed and the nodes left out are freed.
+ *
+ * @a: A pointer to the root of the tree to remove values from.
+ * @b: A pointer to the root of the tree of values to remove.
+ *
+ * Return: A pointer to the root of the difference.
+ */
+avl_t *avl_difference(avl_t *a, avl_t *b)
+{
+	avl_t *a_left, *a_right, *b_left, *b_right, *duplicate;
+
+	if (!a || !b)
+	{
+		binary_tree_delete(b);
+		return (a);
+	}
+
+	avl_expose(b, &b_left, &b_right);
+	duplicate = avl_split(a, b->n, &a_left, &a_right);
+	binary_tree_free(duplicate);
+	binary_tree_free(b);
+
+	return (avl_join2(avl_difference(a_left, b_left),
+			  avl_difference(a_right, b_right)));
+}
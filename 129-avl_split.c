@@ -0,0 +1,89 @@
+#include "binary_trees.h"
+
+/**
+ * avl_split - Splits an AVL tree around a key in O(log n).
+ * The tree is cut along the search path of @key, and the pieces on each
+ * side are joined back together on the way up. The tree is consumed.
+ *
+ * @tree: A pointer to the root of the tree to split, may be NULL.
+ * @key: The value to split around.
+ * @left: A pointer to a variable to store the tree of lower values in.
+ * @right: A pointer to a variable to store the tree of greater values in.
+ *
+ * Return: A pointer to the detached node holding @key, or NULL if the
+ * key is not in the tree.
+ */
+avl_t *avl_split(avl_t *tree, int key, avl_t **left, avl_t **right)
+{
+	avl_t *lower, *greater, *found;
+
+	if (!tree)
+	{
+		*left = *right = NULL;
+		return (NULL);
+	}
+
+	avl_expose(tree, &lower, &greater);
+	if (key == tree->n)
+	{
+		*left = lower;
+		*right = greater;
+		return (tree);
+	}
+	if (key < tree->n)
+	{
+		found = avl_split(lower, key, left, &lower);
+		*right = avl_join_node(lower, tree, greater);
+	}
+	else
+	{
+		found = avl_split(greater, key, &greater, right);
+		*left = avl_join_node(lower, tree, greater);
+	}
+
+	return (found);
+}
+
+/**
+ * avl_split_last - Takes the greatest node out of an AVL tree.
+ *
+ * @tree: A pointer to the root of a non-empty tree, consumed.
+ * @last: A pointer to a variable to store the detached node in.
+ *
+ * Return: A pointer to the root of the remaining tree.
+ */
+avl_t *avl_split_last(avl_t *tree, avl_t **last)
+{
+	avl_t *lower, *greater;
+
+	avl_expose(tree, &lower, &greater);
+	if (!greater)
+	{
+		*last = tree;
+		return (lower);
+	}
+	greater = avl_split_last(greater, last);
+
+	return (avl_join_node(lower, tree, greater));
+}
+
+/**
+ * avl_join2 - Joins two AVL trees with no key between them.
+ * The greatest node of @left is taken out and used as the key.
+ *
+ * @left: A pointer to the root of the lower tree, may be NULL.
+ * @right: A pointer to the root of the greater tree, may be NULL.
+ *
+ * Return: A pointer to the root of the joined tree.
+ */
+avl_t *avl_join2(avl_t *left, avl_t *right)
+{
+	avl_t *last;
+
+	if (!left)
+		return (right);
+
+	left = avl_split_last(left, &last);
+
+	return (avl_join_node(left, last, right));
+}
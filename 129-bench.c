@@ -0,0 +1,71 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * elapsed - Returns the seconds elapsed since a given clock value
+ *
+ * @start: The clock value to measure from
+ *
+ * Return: The elapsed time in seconds
+ */
+double elapsed(clock_t start)
+{
+	return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * bench_union - Times the union of a large and a small tree, with
+ * avl_union then with one avl_cached_insert per value of the small tree
+ *
+ * @keys: The values, the first n for the large tree then m more
+ * @n: Size of the large tree
+ * @m: Size of the small tree
+ */
+void bench_union(int *keys, size_t n, size_t m)
+{
+	avl_t *large = array_to_avl_bulk(keys, n);
+	avl_t *small = array_to_avl_bulk(keys + n, m);
+	clock_t start = clock();
+	size_t i;
+
+	large = avl_union(large, small);
+	printf("  %8lu into %lu: avl_union %.3fs",
+	       (unsigned long)m, (unsigned long)n, elapsed(start));
+	binary_tree_delete(large);
+
+	large = array_to_avl_bulk(keys, n);
+	start = clock();
+	for (i = 0; i < m; i++)
+		avl_cached_insert(&large, keys[n + i]);
+	printf("  inserts %.3fs\n", elapsed(start));
+	binary_tree_delete(large);
+}
+
+/**
+ * main - Benchmarks avl_union against repeated insertions, merging
+ * trees of 1K values up to the size of the large tree into it,
+ * multiplying by 10 at each step
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments, argv[1] being the size of the large tree (default 1M)
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int argc, char **argv)
+{
+	size_t i, m, n = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+	int *keys;
+
+	keys = malloc(sizeof(*keys) * n * 2);
+	if (!keys || n == 0)
+		return (1);
+	srand(98);
+	for (i = 0; i < n * 2; i++)
+		keys[i] = rand();
+	for (m = 1000; m <= n; m *= 10)
+		bench_union(keys, n, m);
+	free(keys);
+	return (0);
+}
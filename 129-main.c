@@ -0,0 +1,73 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_inorder - Prints the values of a tree in order on one line
+ *
+ * @tree: Pointer to the root of the tree
+ */
+void print_inorder(const avl_t *tree)
+{
+	if (!tree)
+		return;
+	print_inorder(tree->left);
+	printf(" %d", tree->n);
+	print_inorder(tree->right);
+}
+
+/**
+ * print_set - Prints a set with its height and AVL property
+ *
+ * @name: Name of the set
+ * @tree: Pointer to the root of the tree
+ */
+void print_set(const char *name, const avl_t *tree)
+{
+	printf("%s:", name);
+	print_inorder(tree);
+	printf(" (height %d, is AVL %d)\n", avl_height(tree),
+	       binary_tree_is_avl(tree) || !tree);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	int a[] = {79, 47, 68, 87, 84, 91, 21, 32, 34, 2, 20, 22, 98, 1};
+	int b[] = {22, 98, 1, 62, 95, 5};
+	size_t na = sizeof(a) / sizeof(a[0]), nb = sizeof(b) / sizeof(b[0]);
+	avl_t *tree, *left, *right, *key;
+	int big[2000], i;
+
+	tree = array_to_avl_bulk(a, na);
+	key = avl_split(tree, 47, &left, &right);
+	print_set("Below 47", left);
+	print_set("Above 47", right);
+	tree = avl_join(left, 50, right);
+	binary_tree_free(key);
+	print_set("Joined with 50", tree);
+	binary_tree_delete(tree);
+	for (i = 0; i < 2000; i++)
+		big[i] = i;
+	tree = avl_join(array_to_avl(big, 2000), 5000, NULL);
+	printf("Joined 0..1999 with 5000: root %d, height %d, is AVL %d\n",
+	       tree->n, avl_height(tree), binary_tree_is_avl(tree));
+	binary_tree_delete(tree);
+
+	tree = avl_union(array_to_avl(a, na), array_to_avl(b, nb));
+	print_set("Union", tree);
+	binary_tree_delete(tree);
+	tree = avl_intersect(array_to_avl_bulk(a, na),
+			     array_to_avl_bulk(b, nb));
+	print_set("Intersection", tree);
+	binary_tree_delete(tree);
+	tree = avl_difference(array_to_avl_bulk(a, na),
+			      array_to_avl_bulk(b, nb));
+	print_set("Difference", tree);
+	binary_tree_delete(tree);
+	return (0);
+}
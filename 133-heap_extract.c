@@ -109,7 +109,7 @@ void delete_last_node(heap_t **tree_root, heap_t *parent_node)
 	{
 		/* If the parent node is the root and has no left child */
 		/* (i.e., the last node is the root). */
-		free(current_root);
+		binary_tree_free(current_root);
 		*tree_root = NULL;
 		return;
 	}
@@ -119,7 +119,7 @@ void delete_last_node(heap_t **tree_root, heap_t *parent_node)
 		/* If the parent node has a right child, copy its value to the root, */
 		/* delete the right child, and set it to NULL. */
 		current_root->n = parent_node->right->n;
-		free(parent_node->right);
+		binary_tree_free(parent_node->right);
 		parent_node->right = NULL;
 	}
 	else if (parent_node->left)
@@ -127,7 +127,7 @@ void delete_last_node(heap_t **tree_root, heap_t *parent_node)
 		/* If the parent node has only a left child, */
 		/* do the same as above but for the left child. */
 		current_root->n = parent_node->left->n;
-		free(parent_node->left);
+		binary_tree_free(parent_node->left);
 		parent_node->left = NULL;
 	}
 
@@ -0,0 +1,100 @@
+#include "binary_trees.h"
+
+/**
+ * array_heap_create - Creates an empty array-backed max-heap.
+ * The heap is stored as a contiguous array in level order: the node at
+ * index i has its children at 2i + 1 and 2i + 2 and its parent at
+ * (i - 1) / 2, so no links are stored and the last slot is known.
+ *
+ * @capacity: The number of values to reserve room for, 0 for a default.
+ *
+ * Return: A pointer to the new heap, or NULL on failure.
+ */
+array_heap_t *array_heap_create(size_t capacity)
+{
+	array_heap_t *heap;
+
+	if (capacity == 0)
+		capacity = 16;
+
+	heap = malloc(sizeof(*heap));
+	if (!heap)
+		return (NULL);
+
+	heap->array = malloc(sizeof(*heap->array) * capacity);
+	if (!heap->array)
+	{
+		free(heap);
+		return (NULL);
+	}
+	heap->size = 0;
+	heap->capacity = capacity;
+
+	return (heap);
+}
+
+/**
+ * array_heap_delete - Deletes an array-backed max-heap.
+ *
+ * @heap: A pointer to the heap to delete.
+ */
+void array_heap_delete(array_heap_t *heap)
+{
+	if (!heap)
+		return;
+
+	free(heap->array);
+	free(heap);
+}
+
+/**
+ * array_heap_push - Inserts a value into an array-backed max-heap.
+ * The array doubles when it is full, then the value is moved up from
+ * the last slot in O(log n) steps.
+ *
+ * @heap: A pointer to the heap.
+ * @value: The value to insert.
+ *
+ * Return: 1 on success, 0 on failure.
+ */
+int array_heap_push(array_heap_t *heap, int value)
+{
+	int *array;
+	size_t i;
+
+	if (!heap)
+		return (0);
+
+	if (heap->size == heap->capacity)
+	{
+		array = realloc(heap->array,
+				sizeof(*array) * heap->capacity * 2);
+		if (!array)
+			return (0);
+		heap->array = array;
+		heap->capacity *= 2;
+	}
+
+	/* Move the parents down until the slot of the value is found */
+	for (i = heap->size++; i > 0 && heap->array[(i - 1) / 2] < value;
+	     i = (i - 1) / 2)
+		heap->array[i] = heap->array[(i - 1) / 2];
+	heap->array[i] = value;
+
+	return (1);
+}
+
+/**
+ * array_heap_peek - Returns the maximum of an array-backed max-heap.
+ *
+ * @heap: A pointer to the heap.
+ *
+ * Return: The value at the root, or 0 if the heap is empty.
+ */
+int array_heap_peek(const array_heap_t *heap)
+{
+	if (!heap || heap->size == 0)
+		return (0);
+
+	return (heap->array[0]);
+}
@@ -0,0 +1,95 @@
+#include "binary_trees.h"
+
+/**
+ * array_heap_fill - Copies a pointer heap into an array in level order.
+ *
+ * @node: A pointer to the current node of the pointer heap.
+ * @array: A pointer to the destination array.
+ * @i: The level-order index of @node.
+ */
+void array_heap_fill(const heap_t *node, int *array, size_t i)
+{
+	if (!node)
+		return;
+
+	array[i] = node->n;
+	array_heap_fill(node->left, array, 2 * i + 1);
+	array_heap_fill(node->right, array, 2 * i + 2);
+}
+
+/**
+ * heap_to_array_heap - Converts a pointer heap into an array-backed heap.
+ * A heap_t is a complete tree, so its nodes map one to one onto the
+ * level-order slots and the copy is already a valid heap.
+ * The pointer heap is left untouched.
+ *
+ * @tree: A pointer to the root node of the pointer heap.
+ *
+ * Return: A pointer to the new array-backed heap, or NULL on failure.
+ */
+array_heap_t *heap_to_array_heap(const heap_t *tree)
+{
+	array_heap_t *heap;
+	size_t size;
+
+	size = binary_tree_size(tree);
+	heap = array_heap_create(size);
+	if (!heap)
+		return (NULL);
+
+	array_heap_fill(tree, heap->array, 0);
+	heap->size = size;
+
+	return (heap);
+}
+
+/**
+ * array_heap_build_tree - Builds the pointer subtree of a level-order slot.
+ *
+ * @parent: A pointer to the parent of the node to build.
+ * @array: A pointer to the heap array.
+ * @size: The number of values in the heap.
+ * @i: The level-order index of the node to build.
+ *
+ * Return: A pointer to the new node, or NULL if @i is out of the heap
+ * or on failure.
+ */
+heap_t *array_heap_build_tree(heap_t *parent, const int *array,
+			      size_t size, size_t i)
+{
+	heap_t *node;
+
+	if (i >= size)
+		return (NULL);
+
+	node = binary_tree_node(parent, array[i]);
+	if (!node)
+		return (NULL);
+	node->left = array_heap_build_tree(node, array, size, 2 * i + 1);
+	node->right = array_heap_build_tree(node, array, size, 2 * i + 2);
+	if ((2 * i + 1 < size && !node->left) ||
+	    (2 * i + 2 < size && !node->right))
+	{
+		binary_tree_delete(node);
+		return (NULL);
+	}
+
+	return (node);
+}
+
+/**
+ * array_heap_to_heap - Converts an array-backed heap into a pointer heap.
+ * The array-backed heap is left untouched.
+ *
+ * @heap: A pointer to the array-backed heap.
+ *
+ * Return: A pointer to the root node of the new pointer heap,
+ * or NULL if the heap is empty or on failure.
+ */
+heap_t *array_heap_to_heap(const array_heap_t *heap)
+{
+	if (!heap || heap->size == 0)
+		return (NULL);
+
+	return (array_heap_build_tree(NULL, heap->array, heap->size, 0));
+}
@@ -0,0 +1,51 @@
+#include "binary_trees.h"
+
+/**
+ * array_heap_sift_down - Moves a value down a level-order max-heap.
+ * The value at @i is moved down, the greater child taking its place,
+ * until both children are lower. The subtrees of @i must be heaps.
+ *
+ * @array: A pointer to the heap array.
+ * @size: The number of values in the heap.
+ * @i: The index of the value to move down.
+ */
+void array_heap_sift_down(int *array, size_t size, size_t i)
+{
+	int value = array[i];
+	size_t child;
+
+	while ((child = 2 * i + 1) < size)
+	{
+		/* Pick the greater child */
+		if (child + 1 < size && array[child + 1] > array[child])
+			child++;
+		if (array[child] <= value)
+			break;
+		array[i] = array[child];
+		i = child;
+	}
+	array[i] = value;
+}
+
+/**
+ * array_heap_pop - Extracts the maximum of an array-backed max-heap.
+ * The last value replaces the root and is moved down, in O(log n).
+ *
+ * @heap: A pointer to the heap.
+ *
+ * Return: The value that was at the root, or 0 if the heap is empty.
+ */
+int array_heap_pop(array_heap_t *heap)
+{
+	int max;
+
+	if (!heap || heap->size == 0)
+		return (0);
+
+	max = heap->array[0];
+	heap->array[0] = heap->array[--heap->size];
+	if (heap->size > 1)
+		array_heap_sift_down(heap->array, heap->size, 0);
+
+	return (max);
+}
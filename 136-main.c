@@ -0,0 +1,40 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	heap_t *tree;
+	array_heap_t *heap;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t i, n = sizeof(array) / sizeof(array[0]);
+
+	heap = array_heap_create(1);
+	if (!heap)
+		return (1);
+	for (i = 0; i < n; i++)
+		array_heap_push(heap, array[i]);
+	printf("Peek: %d\n", array_heap_peek(heap));
+	printf("Popped: %d\n", array_heap_pop(heap));
+	tree = array_heap_to_heap(heap);
+	binary_tree_print(tree);
+	array_heap_delete(heap);
+
+	heap = heap_to_array_heap(tree);
+	if (!heap)
+		return (1);
+	while (heap->size)
+		printf("%d ", array_heap_pop(heap));
+	printf("\n");
+	array_heap_delete(heap);
+	binary_tree_delete(tree);
+	return (0);
+}
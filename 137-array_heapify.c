@@ -0,0 +1,81 @@
+#include "binary_trees.h"
+
+/**
+ * array_heapify - Turns an array into a level-order max-heap in place.
+ * The values are moved down starting from the last parent back to the
+ * root (Floyd's method). Half of the values are leaves and never move,
+ * and a value at height h moves at most h levels, so the whole build
+ * costs O(n) instead of the O(n log n) of one insertion per value.
+ *
+ * @array: A pointer to the array to turn into a heap.
+ * @size: The number of values in the array.
+ */
+void array_heapify(int *array, size_t size)
+{
+	size_t i;
+
+	if (!array || size < 2)
+		return;
+
+	for (i = size / 2; i > 0; i--)
+		array_heap_sift_down(array, size, i - 1);
+}
+
+/**
+ * array_to_array_heap - Builds an array-backed max-heap from an array.
+ * The values are copied then heapified in O(n).
+ *
+ * @array: A pointer to the array of integers.
+ * @size: The number of elements in the array.
+ *
+ * Return: A pointer to the new heap, or NULL on failure.
+ */
+array_heap_t *array_to_array_heap(const int *array, size_t size)
+{
+	array_heap_t *heap;
+
+	if (!array || size == 0)
+		return (NULL);
+
+	heap = array_heap_create(size);
+	if (!heap)
+		return (NULL);
+
+	memcpy(heap->array, array, sizeof(*array) * size);
+	heap->size = size;
+	array_heapify(heap->array, size);
+
+	return (heap);
+}
+
+/**
+ * array_to_heap_bottom_up - Builds a pointer max-heap from an array in O(n).
+ * This is the bulk counterpart of array_to_heap: the values are heapified
+ * in a scratch array, then the nodes are created once each in level order.
+ * The resulting heap holds the same values, but its arrangement may differ
+ * from the one produced by successive heap_insert calls.
+ *
+ * @array: A pointer to the array of integers.
+ * @size: The number of elements in the array.
+ *
+ * Return: A pointer to the root node of the heap, or NULL on failure.
+ */
+heap_t *array_to_heap_bottom_up(int *array, size_t size)
+{
+	heap_t *tree;
+	int *scratch;
+
+	if (!array || size == 0)
+		return (NULL);
+
+	scratch = malloc(sizeof(*scratch) * size);
+	if (!scratch)
+		return (NULL);
+
+	memcpy(scratch, array, sizeof(*array) * size);
+	array_heapify(scratch, size);
+	tree = array_heap_build_tree(NULL, scratch, size, 0);
+	free(scratch);
+
+	return (tree);
+}
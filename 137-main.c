@@ -0,0 +1,35 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	heap_t *tree;
+	array_heap_t *heap;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t n = sizeof(array) / sizeof(array[0]);
+
+	tree = array_to_heap_bottom_up(array, n);
+	if (!tree)
+		return (1);
+	binary_tree_print(tree);
+	printf("Is heap: %d\n", binary_tree_is_heap(tree));
+
+	heap = array_to_array_heap(array, n);
+	if (!heap)
+		return (1);
+	while (heap->size)
+		printf("%d ", array_heap_pop(heap));
+	printf("\n");
+	array_heap_delete(heap);
+	binary_tree_delete(tree);
+	return (0);
+}
@@ -0,0 +1,125 @@
+#include "binary_trees.h"
+
+/**
+ * heap_handle_init - Wraps a pointer max-heap in a size-tracking handle.
+ * The nodes are counted once here; the handle then keeps the count up to
+ * date so that insertions and extractions never have to count again.
+ *
+ * @handle: A pointer to the handle to initialize.
+ * @root: A pointer to the root node of an existing heap, or NULL.
+ */
+void heap_handle_init(heap_handle_t *handle, heap_t *root)
+{
+	if (!handle)
+		return;
+
+	handle->root = root;
+	handle->size = binary_tree_size(root);
+}
+
+/**
+ * heap_handle_node - Finds the node at a level-order position of a heap.
+ * Written in binary, the 1-based position is a 1 followed by the path
+ * from the root: each following bit, from the most significant one,
+ * selects the left (0) or the right (1) child. This takes O(log n) steps.
+ *
+ * @root: A pointer to the root node of the heap.
+ * @position: The 1-based level-order position of the node.
+ *
+ * Return: A pointer to the node, or NULL if there is none.
+ */
+heap_t *heap_handle_node(heap_t *root, size_t position)
+{
+	size_t bit = 1;
+
+	if (position == 0)
+		return (NULL);
+
+	/* Find the bit right below the leading 1 */
+	while (bit <= position / 2)
+		bit <<= 1;
+
+	for (bit >>= 1; root && bit; bit >>= 1)
+		root = position & bit ? root->right : root->left;
+
+	return (root);
+}
+
+/**
+ * heap_handle_insert - Inserts a value into a heap held by a handle.
+ * The parent of the new last slot is reached by following the bits of
+ * the node count, then the value is moved up, so the insertion is
+ * O(log n) with no perfect-subtree checks.
+ *
+ * @handle: A pointer to the heap handle.
+ * @value: The value to insert.
+ *
+ * Return: A pointer to the node holding the value after the insertion,
+ * or NULL on failure.
+ */
+heap_t *heap_handle_insert(heap_handle_t *handle, int value)
+{
+	heap_t *parent, *node;
+
+	if (!handle)
+		return (NULL);
+
+	parent = heap_handle_node(handle->root, (handle->size + 1) / 2);
+	node = binary_tree_node(parent, value);
+	if (!node)
+		return (NULL);
+	if (!parent)
+		handle->root = node;
+	else if ((handle->size + 1) % 2)
+		parent->right = node;
+	else
+		parent->left = node;
+	handle->size++;
+
+	/* Move the value up, moving the lower parents down */
+	for (; node->parent && node->parent->n < value; node = node->parent)
+		node->n = node->parent->n;
+	node->n = value;
+
+	return (node);
+}
+
+/**
+ * heap_handle_extract - Extracts the root of a heap held by a handle.
+ * The last node is reached by following the bits of the node count,
+ * its value replaces the root one and is trickled down, so the
+ * extraction is O(log n) with no counting or parent search.
+ *
+ * @handle: A pointer to the heap handle.
+ *
+ * Return: The value that was at the root, or 0 if the heap is empty.
+ */
+int heap_handle_extract(heap_handle_t *handle)
+{
+	heap_t *last;
+	int max;
+
+	if (!handle || !handle->root)
+		return (0);
+
+	max = handle->root->n;
+	last = heap_handle_node(handle->root, handle->size);
+	handle->size--;
+	if (last == handle->root)
+	{
+		binary_tree_free(last);
+		handle->root = NULL;
+		return (max);
+	}
+
+	/* Unlink the last node and move its value to the root */
+	if (last->parent->right == last)
+		last->parent->right = NULL;
+	else
+		last->parent->left = NULL;
+	handle->root->n = last->n;
+	binary_tree_free(last);
+	trickle_down(handle->root);
+
+	return (max);
+}
@@ -0,0 +1,39 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	heap_handle_t handle;
+	heap_t *node;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t i, n = sizeof(array) / sizeof(array[0]);
+
+	heap_handle_init(&handle, NULL);
+	for (i = 0; i < n; i++)
+	{
+		node = heap_handle_insert(&handle, array[i]);
+		if (!node || node->n != array[i])
+			return (1);
+	}
+	binary_tree_print(handle.root);
+	printf("Size: %lu\n", (unsigned long)handle.size);
+	printf("Extracted: %d\n", heap_handle_extract(&handle));
+	printf("Extracted: %d\n", heap_handle_extract(&handle));
+	binary_tree_print(handle.root);
+
+	heap_handle_init(&handle, handle.root);
+	printf("Size: %lu\n", (unsigned long)handle.size);
+	while (handle.size)
+		printf("%d ", heap_handle_extract(&handle));
+	printf("\n");
+	return (0);
+}
@@ -0,0 +1,127 @@
+#include "binary_trees.h"
+
+/**
+ * heap_sort_drain - Sorts a level-order max-heap in place.
+ * The root is swapped with the last value of the heap, which shrinks by
+ * one and is repaired from the root, until the heap is empty. The values
+ * end up in ascending order, with no memory other than the array.
+ *
+ * @array: A pointer to the heap array.
+ * @size: The number of values in the heap.
+ */
+void heap_sort_drain(int *array, size_t size)
+{
+	size_t end;
+	int max;
+
+	for (end = size; end > 1; end--)
+	{
+		max = array[0];
+		array[0] = array[end - 1];
+		array[end - 1] = max;
+		array_heap_sift_down(array, end - 1, 0);
+	}
+}
+
+/**
+ * heap_sort_reverse - Reverses an array in place.
+ *
+ * @array: A pointer to the array.
+ * @size: The number of values in the array.
+ */
+void heap_sort_reverse(int *array, size_t size)
+{
+	size_t i;
+	int tmp;
+
+	for (i = 0; i < size / 2; i++)
+	{
+		tmp = array[i];
+		array[i] = array[size - 1 - i];
+		array[size - 1 - i] = tmp;
+	}
+}
+
+/**
+ * heap_sort_array - Sorts a caller-supplied array in place with a heap.
+ * The array is heapified in O(n) then drained in O(n log n), without
+ * any allocation.
+ *
+ * @array: A pointer to the array to sort.
+ * @size: The number of values in the array.
+ * @descending: 0 to sort in ascending order, 1 for descending order.
+ */
+void heap_sort_array(int *array, size_t size, int descending)
+{
+	if (!array || size < 2)
+		return;
+
+	array_heapify(array, size);
+	heap_sort_drain(array, size);
+	if (descending)
+		heap_sort_reverse(array, size);
+}
+
+/**
+ * array_heap_wrap - Turns a caller-supplied buffer into an array-backed heap.
+ * The buffer is heapified in place and adopted by the heap, so no value
+ * is copied. It must come from malloc since the heap may grow it with
+ * realloc and array_heap_delete frees it.
+ *
+ * @array: A pointer to a malloc'ed buffer holding the values.
+ * @size: The number of values in the buffer.
+ * @capacity: The number of values the buffer can hold, at least @size.
+ *
+ * Return: A pointer to the new heap, or NULL on failure.
+ */
+array_heap_t *array_heap_wrap(int *array, size_t size, size_t capacity)
+{
+	array_heap_t *heap;
+
+	if (!array || capacity == 0 || capacity < size)
+		return (NULL);
+
+	heap = malloc(sizeof(*heap));
+	if (!heap)
+		return (NULL);
+
+	array_heapify(array, size);
+	heap->array = array;
+	heap->size = size;
+	heap->capacity = capacity;
+
+	return (heap);
+}
+
+/**
+ * array_heap_to_sorted_array - Sorts an array-backed heap into its buffer.
+ * Like heap_to_sorted_array, the values come out in descending order and
+ * the heap is consumed, but the sort is done in place in O(n log n):
+ * the buffer of the heap is returned and only the heap itself is freed.
+ *
+ * @heap: A pointer to the array-backed heap.
+ * @size: A pointer to a variable to store the size of the array.
+ *
+ * Return: A pointer to the sorted array, or NULL if the heap is empty.
+ */
+int *array_heap_to_sorted_array(array_heap_t *heap, size_t *size)
+{
+	int *array;
+
+	*size = 0;
+	if (!heap)
+		return (NULL);
+	if (heap->size == 0)
+	{
+		array_heap_delete(heap);
+		return (NULL);
+	}
+
+	array = heap->array;
+	*size = heap->size;
+	free(heap);
+	heap_sort_drain(array, *size);
+	heap_sort_reverse(array, *size);
+
+	return (array);
+}
@@ -0,0 +1,60 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_array - Prints an array of integers
+ *
+ * @array: The array to be printed
+ * @size: Number of elements in @array
+ */
+void print_array(const int *array, size_t size)
+{
+	size_t i;
+
+	i = 0;
+	while (array && i < size)
+	{
+		if (i > 0)
+			printf(", ");
+		printf("%d", array[i]);
+		++i;
+	}
+	printf("\n");
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	array_heap_t *heap;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t n = sizeof(array) / sizeof(array[0]);
+	int *buffer, *sorted;
+	size_t sorted_size;
+
+	heap_sort_array(array, n, 0);
+	print_array(array, n);
+	heap_sort_array(array, n, 1);
+	print_array(array, n);
+
+	buffer = malloc(sizeof(array));
+	if (!buffer)
+		return (1);
+	memcpy(buffer, array, sizeof(array));
+	heap = array_heap_wrap(buffer, n, n);
+	if (!heap)
+		return (1);
+	array_heap_push(heap, 50);
+	printf("Popped: %d\n", array_heap_pop(heap));
+	sorted = array_heap_to_sorted_array(heap, &sorted_size);
+	print_array(sorted, sorted_size);
+	free(sorted);
+	return (0);
+}
@@ -0,0 +1,103 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * elapsed - Returns the seconds elapsed since a given clock value
+ *
+ * @start: The clock value to measure from
+ *
+ * Return: The elapsed time in seconds
+ */
+double elapsed(clock_t start)
+{
+	return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * bench_dary - Times n insertions then n extractions on a d-ary heap
+ *
+ * @keys: The values to insert
+ * @n: Number of values
+ */
+void bench_dary(const int *keys, size_t n)
+{
+	dary_heap_t *heap = dary_heap_create(0);
+	clock_t start = clock();
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		dary_heap_insert(heap, keys[i]);
+	printf("  %d-ary array heap:  insert %.3fs", DARY_HEAP_D,
+	       elapsed(start));
+	start = clock();
+	for (i = 0; i < n; i++)
+		dary_heap_extract(heap);
+	printf("  extract %.3fs\n", elapsed(start));
+	dary_heap_delete(heap);
+}
+
+/**
+ * bench_binary - Times n insertions then n extractions on binary heaps
+ *
+ * @keys: The values to insert
+ * @n: Number of values
+ */
+void bench_binary(const int *keys, size_t n)
+{
+	array_heap_t *heap = array_heap_create(0);
+	heap_handle_t handle;
+	clock_t start = clock();
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		array_heap_push(heap, keys[i]);
+	printf("  binary array heap: insert %.3fs", elapsed(start));
+	start = clock();
+	for (i = 0; i < n; i++)
+		array_heap_pop(heap);
+	printf("  extract %.3fs\n", elapsed(start));
+	array_heap_delete(heap);
+
+	heap_handle_init(&handle, NULL);
+	start = clock();
+	for (i = 0; i < n; i++)
+		heap_handle_insert(&handle, keys[i]);
+	printf("  binary heap_t:     insert %.3fs", elapsed(start));
+	start = clock();
+	for (i = 0; i < n; i++)
+		heap_handle_extract(&handle);
+	printf("  extract %.3fs\n", elapsed(start));
+}
+
+/**
+ * main - Benchmarks the d-ary heap against the binary heaps
+ * from 1M values up to the size given as argument (default 1M),
+ * multiplying by 10 at each step
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments, argv[1] being the largest size to run
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int argc, char **argv)
+{
+	size_t i, n, max = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+	int *keys;
+
+	keys = malloc(sizeof(*keys) * max);
+	if (!keys)
+		return (1);
+	srand(98);
+	for (i = 0; i < max; i++)
+		keys[i] = rand();
+	for (n = 1000000; n <= max; n *= 10)
+	{
+		printf("%lu values\n", (unsigned long)n);
+		bench_dary(keys, n);
+		bench_binary(keys, n);
+	}
+	free(keys);
+	return (0);
+}
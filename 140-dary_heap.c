@@ -0,0 +1,108 @@
+#include "binary_trees.h"
+
+/**
+ * dary_heap_alloc - Allocates the storage of a d-ary heap.
+ * The values start DARY_HEAP_D - 1 slots into a 64-byte aligned block,
+ * which puts the DARY_HEAP_D children of every node in one aligned group
+ * that never straddles two cache lines.
+ *
+ * @heap: A pointer to the heap to allocate the storage of.
+ * @capacity: The number of values the storage must hold.
+ *
+ * Return: 1 on success, 0 on failure.
+ */
+int dary_heap_alloc(dary_heap_t *heap, size_t capacity)
+{
+	void *base;
+
+	if (posix_memalign(&base, 64,
+			   sizeof(*heap->array) * (capacity + DARY_HEAP_D - 1)))
+		return (0);
+
+	if (heap->base)
+	{
+		memcpy((int *)base + DARY_HEAP_D - 1, heap->array,
+		       sizeof(*heap->array) * heap->size);
+		free(heap->base);
+	}
+	heap->base = base;
+	heap->array = (int *)base + DARY_HEAP_D - 1;
+	heap->capacity = capacity;
+
+	return (1);
+}
+
+/**
+ * dary_heap_create - Creates an empty d-ary max-heap.
+ * Each node has DARY_HEAP_D children (4 by default, 8 when built with
+ * -DDARY_HEAP_D=8): the node at index i has its children at d * i + 1
+ * to d * i + d. The tree is half (or a third) as deep as a binary heap
+ * and a sift-down step reads all the children from a single cache line.
+ *
+ * @capacity: The number of values to reserve room for, 0 for a default.
+ *
+ * Return: A pointer to the new heap, or NULL on failure.
+ */
+dary_heap_t *dary_heap_create(size_t capacity)
+{
+	dary_heap_t *heap;
+
+	heap = malloc(sizeof(*heap));
+	if (!heap)
+		return (NULL);
+
+	heap->base = NULL;
+	heap->size = 0;
+	if (!dary_heap_alloc(heap, capacity ? capacity : 16))
+	{
+		free(heap);
+		return (NULL);
+	}
+
+	return (heap);
+}
+
+/**
+ * dary_heap_delete - Deletes a d-ary max-heap.
+ *
+ * @heap: A pointer to the heap to delete.
+ */
+void dary_heap_delete(dary_heap_t *heap)
+{
+	if (!heap)
+		return;
+
+	free(heap->base);
+	free(heap);
+}
+
+/**
+ * dary_heap_insert - Inserts a value into a d-ary max-heap.
+ * The storage doubles when it is full, then the value is moved up from
+ * the last slot in O(log_d n) steps.
+ *
+ * @heap: A pointer to the heap.
+ * @value: The value to insert.
+ *
+ * Return: 1 on success, 0 on failure.
+ */
+int dary_heap_insert(dary_heap_t *heap, int value)
+{
+	size_t i;
+
+	if (!heap)
+		return (0);
+
+	if (heap->size == heap->capacity &&
+	    !dary_heap_alloc(heap, heap->capacity * 2))
+		return (0);
+
+	/* Move the parents down until the slot of the value is found */
+	for (i = heap->size++;
+	     i > 0 && heap->array[(i - 1) / DARY_HEAP_D] < value;
+	     i = (i - 1) / DARY_HEAP_D)
+		heap->array[i] = heap->array[(i - 1) / DARY_HEAP_D];
+	heap->array[i] = value;
+
+	return (1);
+}
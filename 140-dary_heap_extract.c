@@ -0,0 +1,55 @@
+#include "binary_trees.h"
+
+/**
+ * dary_heap_sift_down - Moves a value down a d-ary max-heap.
+ * At each level the greatest of the (up to) DARY_HEAP_D children,
+ * which share one cache line, takes the place of the value.
+ *
+ * @array: A pointer to the values of the heap.
+ * @size: The number of values in the heap.
+ * @i: The index of the value to move down.
+ */
+void dary_heap_sift_down(int *array, size_t size, size_t i)
+{
+	int value = array[i], best;
+	size_t child, last, max;
+
+	while ((child = DARY_HEAP_D * i + 1) < size)
+	{
+		/* Find the greatest child */
+		last = child + DARY_HEAP_D < size ? child + DARY_HEAP_D : size;
+		for (max = child, best = array[child++]; child < last; child++)
+		{
+			max = array[child] > best ? child : max;
+			best = array[max];
+		}
+		if (best <= value)
+			break;
+		array[i] = best;
+		i = max;
+	}
+	array[i] = value;
+}
+
+/**
+ * dary_heap_extract - Extracts the maximum of a d-ary max-heap.
+ * The last value replaces the root and is moved down in O(log_d n) levels.
+ *
+ * @heap: A pointer to the heap.
+ *
+ * Return: The value that was at the root, or 0 if the heap is empty.
+ */
+int dary_heap_extract(dary_heap_t *heap)
+{
+	int max;
+
+	if (!heap || heap->size == 0)
+		return (0);
+
+	max = heap->array[0];
+	heap->array[0] = heap->array[--heap->size];
+	if (heap->size > 1)
+		dary_heap_sift_down(heap->array, heap->size, 0);
+
+	return (max);
+}
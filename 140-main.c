@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	dary_heap_t *heap;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t i, offset, n = sizeof(array) / sizeof(array[0]);
+
+	heap = dary_heap_create(1);
+	if (!heap)
+		return (1);
+	for (i = 0; i < n; i++)
+		dary_heap_insert(heap, array[i]);
+	printf("Fan-out: %d\n", DARY_HEAP_D);
+	offset = (size_t)(heap->array + 1) % (DARY_HEAP_D * sizeof(int));
+	printf("Children aligned: %d\n", offset == 0);
+	while (heap->size)
+		printf("%d ", dary_heap_extract(heap));
+	printf("\n");
+	dary_heap_delete(heap);
+	return (0);
+}
@@ -0,0 +1,113 @@
+#include "binary_trees.h"
+
+/**
+ * indexed_heap_grow - Resizes the arrays of an indexed max-heap.
+ *
+ * @heap: A pointer to the heap.
+ * @capacity: The number of handles the arrays must hold.
+ *
+ * Return: 1 on success, 0 on failure.
+ */
+int indexed_heap_grow(indexed_heap_t *heap, size_t capacity)
+{
+	int *priority;
+	size_t *order, *pos;
+
+	priority = realloc(heap->priority, sizeof(*priority) * capacity);
+	if (priority)
+		heap->priority = priority;
+	order = realloc(heap->heap, sizeof(*order) * capacity);
+	if (order)
+		heap->heap = order;
+	pos = realloc(heap->pos, sizeof(*pos) * capacity);
+	if (pos)
+		heap->pos = pos;
+	if (!priority || !order || !pos)
+		return (0);
+
+	heap->capacity = capacity;
+	return (1);
+}
+
+/**
+ * indexed_heap_create - Creates an empty indexed max-heap.
+ * Entries are referred to by handles that stay valid until the entry
+ * leaves the heap, whatever moves happen inside the heap, so that the
+ * priority of an entry can be changed or the entry removed later.
+ *
+ * @capacity: The number of entries to reserve room for, 0 for a default.
+ *
+ * Return: A pointer to the new heap, or NULL on failure.
+ */
+indexed_heap_t *indexed_heap_create(size_t capacity)
+{
+	indexed_heap_t *heap;
+
+	heap = malloc(sizeof(*heap));
+	if (!heap)
+		return (NULL);
+
+	heap->priority = NULL;
+	heap->heap = NULL;
+	heap->pos = NULL;
+	heap->size = 0;
+	heap->count = 0;
+	if (!indexed_heap_grow(heap, capacity ? capacity : 16))
+	{
+		indexed_heap_delete(heap);
+		return (NULL);
+	}
+
+	return (heap);
+}
+
+/**
+ * indexed_heap_delete - Deletes an indexed max-heap.
+ *
+ * @heap: A pointer to the heap to delete.
+ */
+void indexed_heap_delete(indexed_heap_t *heap)
+{
+	if (!heap)
+		return;
+
+	free(heap->priority);
+	free(heap->heap);
+	free(heap->pos);
+	free(heap);
+}
+
+/**
+ * indexed_heap_insert - Inserts an entry into an indexed max-heap.
+ * Handles of entries that left the heap are kept right after the heap
+ * part of the order array and are reused first.
+ *
+ * @heap: A pointer to the heap.
+ * @priority: The priority of the new entry.
+ *
+ * Return: The handle of the new entry, or INDEXED_HEAP_NONE on failure.
+ */
+size_t indexed_heap_insert(indexed_heap_t *heap, int priority)
+{
+	size_t handle;
+
+	if (!heap)
+		return (INDEXED_HEAP_NONE);
+
+	if (heap->size < heap->count)
+		handle = heap->heap[heap->size];
+	else
+	{
+		if (heap->count == heap->capacity &&
+		    !indexed_heap_grow(heap, heap->capacity * 2))
+			return (INDEXED_HEAP_NONE);
+		handle = heap->count++;
+	}
+
+	heap->priority[handle] = priority;
+	heap->heap[heap->size] = handle;
+	heap->pos[handle] = heap->size;
+	indexed_heap_sift_up(heap, heap->size++);
+
+	return (handle);
+}
@@ -0,0 +1,55 @@
+#include "binary_trees.h"
+
+/**
+ * indexed_heap_sift_up - Moves an entry up an indexed max-heap.
+ * The position of every handle that moves is updated along the way.
+ *
+ * @heap: A pointer to the heap.
+ * @i: The position of the entry to move up.
+ */
+void indexed_heap_sift_up(indexed_heap_t *heap, size_t i)
+{
+	size_t handle = heap->heap[i], parent;
+	int priority = heap->priority[handle];
+
+	while (i > 0)
+	{
+		parent = heap->heap[(i - 1) / 2];
+		if (heap->priority[parent] >= priority)
+			break;
+		heap->heap[i] = parent;
+		heap->pos[parent] = i;
+		i = (i - 1) / 2;
+	}
+	heap->heap[i] = handle;
+	heap->pos[handle] = i;
+}
+
+/**
+ * indexed_heap_sift_down - Moves an entry down an indexed max-heap.
+ * The position of every handle that moves is updated along the way.
+ *
+ * @heap: A pointer to the heap.
+ * @i: The position of the entry to move down.
+ */
+void indexed_heap_sift_down(indexed_heap_t *heap, size_t i)
+{
+	size_t handle = heap->heap[i], child;
+	int priority = heap->priority[handle];
+
+	while ((child = 2 * i + 1) < heap->size)
+	{
+		/* Pick the child with the greater priority */
+		if (child + 1 < heap->size &&
+		    heap->priority[heap->heap[child + 1]] >
+		    heap->priority[heap->heap[child]])
+			child++;
+		if (heap->priority[heap->heap[child]] <= priority)
+			break;
+		heap->heap[i] = heap->heap[child];
+		heap->pos[heap->heap[i]] = i;
+		i = child;
+	}
+	heap->heap[i] = handle;
+	heap->pos[handle] = i;
+}
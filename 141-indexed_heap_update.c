@@ -0,0 +1,97 @@
+#include "binary_trees.h"
+
+/**
+ * indexed_heap_contains - Checks if a handle refers to an entry in a heap.
+ *
+ * @heap: A pointer to the heap.
+ * @handle: The handle to check.
+ *
+ * Return: 1 if the entry is in the heap, 0 otherwise.
+ */
+int indexed_heap_contains(const indexed_heap_t *heap, size_t handle)
+{
+	return (heap && handle < heap->count && heap->pos[handle] < heap->size);
+}
+
+/**
+ * indexed_heap_update - Changes the priority of an entry of an indexed heap.
+ * The entry is moved up or down from its current position, in O(log n).
+ *
+ * @heap: A pointer to the heap.
+ * @handle: The handle of the entry.
+ * @priority: The new priority of the entry.
+ *
+ * Return: 1 on success, 0 if the handle is not in the heap.
+ */
+int indexed_heap_update(indexed_heap_t *heap, size_t handle, int priority)
+{
+	int old;
+
+	if (!indexed_heap_contains(heap, handle))
+		return (0);
+
+	old = heap->priority[handle];
+	heap->priority[handle] = priority;
+	if (priority > old)
+		indexed_heap_sift_up(heap, heap->pos[handle]);
+	else if (priority < old)
+		indexed_heap_sift_down(heap, heap->pos[handle]);
+
+	return (1);
+}
+
+/**
+ * indexed_heap_remove - Removes an entry from an indexed max-heap.
+ * The last entry takes the place of the removed one and is moved up or
+ * down, in O(log n). The handle of the removed entry is parked right
+ * after the heap part of the order array to be reused later.
+ *
+ * @heap: A pointer to the heap.
+ * @handle: The handle of the entry to remove.
+ *
+ * Return: 1 on success, 0 if the handle is not in the heap.
+ */
+int indexed_heap_remove(indexed_heap_t *heap, size_t handle)
+{
+	size_t i, last;
+
+	if (!indexed_heap_contains(heap, handle))
+		return (0);
+
+	i = heap->pos[handle];
+	last = heap->heap[--heap->size];
+	heap->heap[heap->size] = handle;
+	heap->pos[handle] = heap->size;
+	if (i == heap->size)
+		return (1);
+
+	heap->heap[i] = last;
+	heap->pos[last] = i;
+	indexed_heap_sift_up(heap, i);
+	indexed_heap_sift_down(heap, heap->pos[last]);
+
+	return (1);
+}
+
+/**
+ * indexed_heap_extract - Extracts the entry with the highest priority.
+ *
+ * @heap: A pointer to the heap.
+ * @handle: A pointer to store the handle of the entry at, or NULL.
+ *
+ * Return: The priority of the extracted entry, or 0 if the heap is empty.
+ */
+int indexed_heap_extract(indexed_heap_t *heap, size_t *handle)
+{
+	size_t top;
+
+	if (!heap || heap->size == 0)
+		return (0);
+
+	top = heap->heap[0];
+	if (handle)
+		*handle = top;
+	indexed_heap_remove(heap, top);
+
+	return (heap->priority[top]);
+}
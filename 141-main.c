@@ -0,0 +1,45 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	indexed_heap_t *heap;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t i, n = sizeof(array) / sizeof(array[0]);
+	size_t handles[sizeof(array) / sizeof(array[0])], handle;
+	int priority;
+
+	heap = indexed_heap_create(1);
+	if (!heap)
+		return (1);
+	for (i = 0; i < n; i++)
+		handles[i] = indexed_heap_insert(heap, array[i]);
+
+	indexed_heap_update(heap, handles[9], 100);
+	printf("Updated %d -> 100\n", array[9]);
+	indexed_heap_update(heap, handles[12], 0);
+	printf("Updated %d -> 0\n", array[12]);
+	indexed_heap_remove(heap, handles[0]);
+	printf("Removed %d\n", array[0]);
+	printf("Remove again: %d\n", indexed_heap_remove(heap, handles[0]));
+
+	handle = indexed_heap_insert(heap, 50);
+	printf("Reused handle: %d\n", handle == handles[0]);
+	while (heap->size)
+	{
+		priority = indexed_heap_extract(heap, &handle);
+		printf("%d(#%lu) ", priority, (unsigned long)handle);
+	}
+	printf("\n");
+	indexed_heap_delete(heap);
+	return (0);
+}
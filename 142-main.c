@@ -0,0 +1,40 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	pairing_heap_t first = {NULL, 0}, second = {NULL, 0};
+	heap_t *tree;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t i, n = sizeof(array) / sizeof(array[0]);
+
+	for (i = 0; i < n / 2; i++)
+		pairing_heap_insert(&first, array[i]);
+	for (; i < n; i++)
+		pairing_heap_insert(&second, array[i]);
+	printf("Extracted: %d\n", pairing_heap_extract(&first));
+	printf("Extracted: %d\n", pairing_heap_extract(&second));
+
+	pairing_heap_meld(&first, &second);
+	printf("Melded size: %lu\n", (unsigned long)first.size);
+
+	tree = array_to_heap(array, n);
+	if (!tree)
+		return (1);
+	heap_to_pairing_heap(&first, tree);
+	printf("Size: %lu\n", (unsigned long)first.size);
+	for (i = 0; i < 6; i++)
+		printf("%d ", pairing_heap_extract(&first));
+	printf("\n");
+	pairing_heap_delete(&first);
+	return (0);
+}
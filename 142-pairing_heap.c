@@ -0,0 +1,132 @@
+#include "binary_trees.h"
+
+/**
+ * pairing_link - Links two pairing heap trees into one.
+ * The root with the lower value becomes the first child of the other.
+ *
+ * @first: A pointer to the root of the first tree.
+ * @second: A pointer to the root of the second tree.
+ *
+ * Return: A pointer to the root of the linked tree.
+ */
+pairing_node_t *pairing_link(pairing_node_t *first, pairing_node_t *second)
+{
+	pairing_node_t *tmp;
+
+	if (!first)
+		return (second);
+	if (!second)
+		return (first);
+
+	if (second->n > first->n)
+		tmp = first, first = second, second = tmp;
+	second->right = first->left;
+	first->left = second;
+
+	return (first);
+}
+
+/**
+ * pairing_heap_insert - Inserts a value into a pairing max-heap in O(1).
+ *
+ * @heap: A pointer to the pairing heap.
+ * @value: The value to insert.
+ *
+ * Return: A pointer to the new node, or NULL on failure.
+ */
+pairing_node_t *pairing_heap_insert(pairing_heap_t *heap, int value)
+{
+	pairing_node_t *node;
+
+	if (!heap)
+		return (NULL);
+
+	node = binary_tree_node(NULL, value);
+	if (!node)
+		return (NULL);
+	heap->root = pairing_link(heap->root, node);
+	heap->size++;
+
+	return (node);
+}
+
+/**
+ * pairing_heap_meld - Moves all the values of a pairing heap into another.
+ * This is a single link of the two roots, O(1) whatever the sizes.
+ *
+ * @heap: A pointer to the pairing heap receiving the values.
+ * @other: A pointer to the pairing heap to empty into @heap.
+ */
+void pairing_heap_meld(pairing_heap_t *heap, pairing_heap_t *other)
+{
+	if (!heap || !other || heap == other)
+		return;
+
+	heap->root = pairing_link(heap->root, other->root);
+	heap->size += other->size;
+	other->root = NULL;
+	other->size = 0;
+}
+
+/**
+ * pairing_merge_pairs - Merges a list of sibling trees into one tree.
+ * The siblings are first linked two by two from left to right, which
+ * builds a reversed list of pairs, then the pairs are linked into one
+ * tree from right to left. This two-pass scheme is what gives the
+ * amortized O(log n) extraction, and it runs without recursion.
+ *
+ * @first: A pointer to the first tree of the sibling list.
+ *
+ * Return: A pointer to the root of the merged tree.
+ */
+pairing_node_t *pairing_merge_pairs(pairing_node_t *first)
+{
+	pairing_node_t *pairs = NULL, *a, *b, *root = NULL;
+
+	while (first)
+	{
+		a = first;
+		b = a->right;
+		first = b ? b->right : NULL;
+		a->right = NULL;
+		if (b)
+			b->right = NULL;
+		a = pairing_link(a, b);
+		a->right = pairs;
+		pairs = a;
+	}
+
+	while (pairs)
+	{
+		a = pairs;
+		pairs = a->right;
+		a->right = NULL;
+		root = pairing_link(root, a);
+	}
+
+	return (root);
+}
+
+/**
+ * pairing_heap_extract - Extracts the maximum of a pairing max-heap.
+ *
+ * @heap: A pointer to the pairing heap.
+ *
+ * Return: The value that was at the root, or 0 if the heap is empty.
+ */
+int pairing_heap_extract(pairing_heap_t *heap)
+{
+	pairing_node_t *root;
+	int max;
+
+	if (!heap || !heap->root)
+		return (0);
+
+	root = heap->root;
+	max = root->n;
+	heap->root = pairing_merge_pairs(root->left);
+	heap->size--;
+	binary_tree_free(root);
+
+	return (max);
+}
@@ -0,0 +1,84 @@
+#include "binary_trees.h"
+
+/**
+ * pairing_from_heap - Relinks a pointer heap as a pairing heap tree.
+ * The two children of a heap node become its list of children: the left
+ * child first, the right child as its sibling. Each subtree is relinked
+ * before its right link is reused as a sibling link, so the nodes are
+ * reused as they are, without any allocation.
+ *
+ * @node: A pointer to the root node of the pointer heap.
+ */
+void pairing_from_heap(heap_t *node)
+{
+	heap_t *left, *right;
+
+	if (!node)
+		return;
+
+	left = node->left;
+	right = node->right;
+	pairing_from_heap(left);
+	pairing_from_heap(right);
+
+	node->parent = NULL;
+	node->right = NULL;
+	node->left = left ? left : right;
+	if (left)
+		left->right = right;
+}
+
+/**
+ * heap_to_pairing_heap - Consumes a pointer heap into a pairing heap.
+ * The nodes of the heap_t are reused in O(n) and the result is melded
+ * into @heap in O(1); the heap_t must not be used afterwards.
+ *
+ * @heap: A pointer to the pairing heap receiving the values.
+ * @tree: A pointer to the root node of the pointer heap to consume.
+ */
+void heap_to_pairing_heap(pairing_heap_t *heap, heap_t *tree)
+{
+	pairing_heap_t other;
+
+	if (!heap || !tree)
+		return;
+
+	other.size = binary_tree_size(tree);
+	pairing_from_heap(tree);
+	other.root = tree;
+	pairing_heap_meld(heap, &other);
+}
+
+/**
+ * pairing_heap_delete - Deletes all the nodes of a pairing heap.
+ * The child lists can be as long as the heap, so the tree is flattened
+ * with rotations instead of being walked recursively.
+ *
+ * @heap: A pointer to the pairing heap to empty.
+ */
+void pairing_heap_delete(pairing_heap_t *heap)
+{
+	pairing_node_t *node, *child;
+
+	if (!heap)
+		return;
+
+	node = heap->root;
+	while (node)
+	{
+		if (node->left)
+		{
+			/* Rotate the first child above its parent */
+			child = node->left;
+			node->left = child->right;
+			child->right = node;
+			node = child;
+			continue;
+		}
+		child = node->right;
+		binary_tree_free(node);
+		node = child;
+	}
+	heap->root = NULL;
+	heap->size = 0;
+}
@@ -0,0 +1,146 @@
+#include "binary_trees.h"
+
+/**
+ * heap_frontier_push - Adds a node to a frontier of heap nodes.
+ * The frontier is itself a level-order max-heap of node pointers,
+ * ordered by the values of the nodes.
+ *
+ * @frontier: A pointer to the frontier array.
+ * @size: A pointer to the number of nodes in the frontier.
+ * @node: A pointer to the node to add.
+ */
+void heap_frontier_push(const heap_t **frontier, size_t *size,
+			const heap_t *node)
+{
+	size_t i;
+
+	for (i = (*size)++; i > 0 && frontier[(i - 1) / 2]->n < node->n;
+	     i = (i - 1) / 2)
+		frontier[i] = frontier[(i - 1) / 2];
+	frontier[i] = node;
+}
+
+/**
+ * heap_frontier_pop - Removes the node with the greatest value
+ * from a frontier of heap nodes.
+ *
+ * @frontier: A pointer to the frontier array.
+ * @size: A pointer to the number of nodes in the frontier, at least 1.
+ *
+ * Return: A pointer to the removed node.
+ */
+const heap_t *heap_frontier_pop(const heap_t **frontier, size_t *size)
+{
+	const heap_t *top = frontier[0], *last = frontier[--(*size)];
+	size_t i = 0, child;
+
+	while ((child = 2 * i + 1) < *size)
+	{
+		if (child + 1 < *size &&
+		    frontier[child + 1]->n > frontier[child]->n)
+			child++;
+		if (frontier[child]->n <= last->n)
+			break;
+		frontier[i] = frontier[child];
+		i = child;
+	}
+	frontier[i] = last;
+
+	return (top);
+}
+
+/**
+ * heap_count_upto - Counts the nodes of a heap, stopping at a limit.
+ * At most @limit nodes are visited, so the count costs O(limit) even
+ * when the heap is much larger.
+ *
+ * @root: A pointer to the root node of the heap.
+ * @limit: The greatest count of interest.
+ *
+ * Return: The number of nodes in the heap, or @limit if it has more.
+ */
+size_t heap_count_upto(const heap_t *root, size_t limit)
+{
+	size_t left;
+
+	if (!root || limit == 0)
+		return (0);
+
+	left = heap_count_upto(root->left, limit - 1);
+
+	return (1 + left + heap_count_upto(root->right, limit - 1 - left));
+}
+
+/**
+ * heap_frontier_walk - Visits the k greatest nodes of a heap in order.
+ * The k greatest values of a heap form a subtree around the root, so they
+ * are found by growing that subtree one node at a time, always taking the
+ * greatest node of its frontier. A node is always visited after its
+ * parent.
+ *
+ * @root: A pointer to the root node of the heap.
+ * @k: The number of nodes to visit, at most the size of the heap.
+ * @out: A pointer to an array of @k ints receiving the values in
+ * descending order.
+ * @frontier: A pointer to an array of @k + 1 node pointers to work in.
+ * @nodes: A pointer to an array of @k node pointers receiving the
+ * visited nodes, or NULL.
+ *
+ * Return: The number of nodes visited.
+ */
+size_t heap_frontier_walk(const heap_t *root, size_t k, int *out,
+			  const heap_t **frontier, const heap_t **nodes)
+{
+	const heap_t *node;
+	size_t size = 0, count = 0;
+
+	heap_frontier_push(frontier, &size, root);
+	while (count < k && size)
+	{
+		node = heap_frontier_pop(frontier, &size);
+		if (nodes)
+			nodes[count] = node;
+		out[count++] = node->n;
+		if (node->left)
+			heap_frontier_push(frontier, &size, node->left);
+		if (node->right)
+			heap_frontier_push(frontier, &size, node->right);
+	}
+
+	return (count);
+}
+
+/**
+ * heap_peek_k - Reads the k greatest values of a heap without changing it.
+ * The values are read by heap_frontier_walk: only O(k) nodes are visited
+ * and the frontier never holds more than k + 1 nodes, hence O(k log k).
+ *
+ * @root: A pointer to the root node of the heap.
+ * @k: The number of values to read.
+ * @out: A pointer to an array of at least @k ints receiving the values
+ * in descending order.
+ *
+ * Return: The number of values written, less than @k if the heap is
+ * smaller, or 0 on failure.
+ */
+size_t heap_peek_k(const heap_t *root, size_t k, int *out)
+{
+	const heap_t **frontier;
+	size_t count;
+
+	if (!root || !out || k == 0)
+		return (0);
+
+	/* The frontier never outgrows the heap, whatever @k is */
+	k = heap_count_upto(root, k);
+	if (k >= (size_t)-1 / sizeof(*frontier))
+		return (0);
+	frontier = malloc(sizeof(*frontier) * (k + 1));
+	if (!frontier)
+		return (0);
+
+	count = heap_frontier_walk(root, k, out, frontier, NULL);
+	free(frontier);
+
+	return (count);
+}
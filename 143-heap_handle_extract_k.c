@@ -0,0 +1,149 @@
+#include "binary_trees.h"
+
+/**
+ * heap_node_position - Computes the level-order position of a heap node.
+ * Walking up to the root gives the path to the node, one bit per level,
+ * which is the 1-based position without its leading 1 (see
+ * heap_handle_node). This takes O(log n) steps.
+ *
+ * @node: A pointer to the node.
+ *
+ * Return: The 1-based level-order position of @node.
+ */
+size_t heap_node_position(const heap_t *node)
+{
+	size_t path = 0, bit = 1;
+
+	for (; node->parent; node = node->parent, bit <<= 1)
+		if (node->parent->right == node)
+			path |= bit;
+
+	return (bit | path);
+}
+
+/**
+ * heap_extract_refill - Takes the k greatest nodes out of a heap.
+ * The last k nodes in level order are the ones that go away. The greatest
+ * nodes that are not among them leave holes, which are filled with the
+ * values of the last nodes that are not among the greatest ones, then
+ * the last nodes are unlinked. The holes are finally trickled down from
+ * the deepest one up, as in a bottom-up heap construction, which costs
+ * O(k log n) in all.
+ *
+ * @handle: A pointer to the heap handle.
+ * @found: A pointer to the k greatest nodes, each after its parent,
+ * overwritten.
+ * @k: The number of nodes to take out, at most the size of the heap.
+ * @last: A pointer to an array of @k flags to work in.
+ */
+void heap_extract_refill(heap_handle_t *handle, const heap_t **found,
+			 size_t k, unsigned char *last)
+{
+	size_t i, next = 0, base = handle->size - k, position;
+	heap_t *node;
+
+	/* Flag the greatest nodes that go away anyway, they leave no hole */
+	memset(last, 0, k);
+	for (i = 0; i < k; i++)
+	{
+		position = heap_node_position(found[i]);
+		if (position > base)
+		{
+			last[position - base - 1] = 1;
+			found[i] = NULL;
+		}
+	}
+	for (i = 0; i < k; i++)
+	{
+		if (!found[i])
+			continue;
+		while (last[next])
+			next++;
+		node = heap_handle_node(handle->root, base + 1 + next++);
+		((heap_t *)found[i])->n = node->n;
+	}
+
+	for (position = handle->size; position > base; position--)
+	{
+		node = heap_handle_node(handle->root, position);
+		if (!node->parent)
+			handle->root = NULL;
+		else if (node->parent->right == node)
+			node->parent->right = NULL;
+		else
+			node->parent->left = NULL;
+		binary_tree_free(node);
+	}
+	handle->size = base;
+
+	for (i = k; i-- > 0;)
+		if (found[i])
+			trickle_down((heap_t *)found[i]);
+}
+
+/**
+ * heap_handle_extract_k - Extracts the k greatest values of a heap held
+ * by a handle.
+ * The values are found with heap_frontier_walk, then the heap is
+ * restructured once by heap_extract_refill, in O(k log n) overall
+ * instead of k separate extractions.
+ *
+ * @handle: A pointer to the heap handle.
+ * @k: The number of values to extract.
+ * @out: A pointer to an array of at least @k ints receiving the values
+ * in descending order.
+ *
+ * Return: The number of values extracted, less than @k if the heap
+ * was smaller, or 0 on failure.
+ */
+size_t heap_handle_extract_k(heap_handle_t *handle, size_t k, int *out)
+{
+	const heap_t **found;
+
+	if (!handle || !handle->root || !out)
+		return (0);
+
+	if (k > handle->size)
+		k = handle->size;
+	if (k == 0 || k >= (size_t)-1 / (sizeof(*found) * 3))
+		return (0);
+
+	/* The k nodes, a frontier of k + 1 nodes and k flags */
+	found = malloc(sizeof(*found) * (2 * k + 1) + k);
+	if (!found)
+		return (0);
+
+	heap_frontier_walk(handle->root, k, out, found + k, found);
+	heap_extract_refill(handle, found, k,
+			    (unsigned char *)(found + 2 * k + 1));
+	free(found);
+
+	return (k);
+}
+
+/**
+ * heap_extract_k - Extracts the k greatest values of a heap.
+ * The heap is counted once, then the k values are taken out in one pass
+ * by heap_handle_extract_k.
+ *
+ * @root: A double pointer to the root node of the heap.
+ * @k: The number of values to extract.
+ * @out: A pointer to an array of at least @k ints receiving the values
+ * in descending order.
+ *
+ * Return: The number of values extracted, less than @k if the heap
+ * was smaller, or 0 on failure.
+ */
+size_t heap_extract_k(heap_t **root, size_t k, int *out)
+{
+	heap_handle_t handle;
+
+	if (!root)
+		return (0);
+
+	heap_handle_init(&handle, *root);
+	k = heap_handle_extract_k(&handle, k, out);
+	*root = handle.root;
+
+	return (k);
+}
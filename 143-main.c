@@ -0,0 +1,57 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_array - Prints an array of integers
+ *
+ * @array: The array to be printed
+ * @size: Number of elements in @array
+ */
+void print_array(const int *array, size_t size)
+{
+	size_t i;
+
+	i = 0;
+	while (array && i < size)
+	{
+		if (i > 0)
+			printf(", ");
+		printf("%d", array[i]);
+		++i;
+	}
+	printf("\n");
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	heap_t *tree;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t n = sizeof(array) / sizeof(array[0]);
+	int top[20];
+	size_t count;
+
+	tree = array_to_heap(array, n);
+	if (!tree)
+		return (1);
+	count = heap_peek_k(tree, 5, top);
+	print_array(top, count);
+	binary_tree_print(tree);
+
+	count = heap_extract_k(&tree, 5, top);
+	print_array(top, count);
+	binary_tree_print(tree);
+
+	count = heap_extract_k(&tree, 20, top);
+	print_array(top, count);
+	printf("Empty: %d\n", tree == NULL);
+	return (0);
+}
@@ -0,0 +1,70 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_array - Prints an array of integers
+ *
+ * @array: The array to be printed
+ * @size: Number of elements in @array
+ */
+void print_array(const int *array, size_t size)
+{
+	size_t i;
+
+	i = 0;
+	while (array && i < size)
+	{
+		if (i > 0)
+			printf(", ");
+		printf("%d", array[i]);
+		++i;
+	}
+	printf("\n");
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	top_k_t *top;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t n = sizeof(array) / sizeof(array[0]);
+	int negative[] = {-10, -20}, later[] = {-5};
+	int *sorted;
+	size_t i, kept, sorted_size;
+
+	top = top_k_create(5);
+	if (!top)
+		return (1);
+	kept = top_k_push_batch(top, array, n);
+	printf("Kept: %lu\n", (unsigned long)kept);
+	sorted = top_k_sorted(top, &sorted_size);
+	print_array(sorted, sorted_size);
+	free(sorted);
+
+	for (i = 0; i < 1000000; i++)
+		top_k_push(top, (int)(i % 1000));
+	sorted = top_k_sorted(top, &sorted_size);
+	print_array(sorted, sorted_size);
+	free(sorted);
+	top_k_delete(top);
+
+	top = top_k_create(2);
+	if (!top)
+		return (1);
+	top_k_push_batch(top, negative, 2);
+	kept = top_k_push_batch(top, later, 1);
+	printf("Kept: %lu\n", (unsigned long)kept);
+	sorted = top_k_sorted(top, &sorted_size);
+	print_array(sorted, sorted_size);
+	free(sorted);
+	top_k_delete(top);
+	return (0);
+}
@@ -0,0 +1,118 @@
+#include "binary_trees.h"
+
+/**
+ * top_k_create - Creates a collector keeping the k greatest values seen.
+ * The values are kept in a level-order min-heap of at most k values, so
+ * the smallest kept value, the admission threshold, is always at the
+ * root and memory stays O(k) however long the stream is. Each value is
+ * stored complemented (~value), which reverses the order without
+ * overflow, so the min-heap is repaired by array_heap_sift_down.
+ *
+ * @k: The number of values to keep.
+ *
+ * Return: A pointer to the new collector, or NULL on failure.
+ */
+top_k_t *top_k_create(size_t k)
+{
+	top_k_t *top;
+
+	if (k == 0)
+		return (NULL);
+
+	top = malloc(sizeof(*top));
+	if (!top)
+		return (NULL);
+
+	top->array = malloc(sizeof(*top->array) * k);
+	if (!top->array)
+	{
+		free(top);
+		return (NULL);
+	}
+	top->size = 0;
+	top->k = k;
+
+	return (top);
+}
+
+/**
+ * top_k_delete - Deletes a top-k collector.
+ *
+ * @top: A pointer to the collector to delete.
+ */
+void top_k_delete(top_k_t *top)
+{
+	if (!top)
+		return;
+
+	free(top->array);
+	free(top);
+}
+
+/**
+ * top_k_push - Offers a value to a top-k collector.
+ * Once the collector is full, a value not above the threshold is
+ * rejected in O(1); otherwise it replaces the threshold in O(log k).
+ *
+ * @top: A pointer to the collector.
+ * @value: The value to offer.
+ *
+ * Return: 1 if the value was kept, 0 otherwise.
+ */
+int top_k_push(top_k_t *top, int value)
+{
+	size_t i;
+
+	if (!top)
+		return (0);
+
+	if (top->size == top->k)
+	{
+		if (value <= ~top->array[0])
+			return (0);
+		top->array[0] = ~value;
+		array_heap_sift_down(top->array, top->size, 0);
+		return (1);
+	}
+
+	/* Not full yet: move the value up from the last slot */
+	for (i = top->size++; i > 0 && top->array[(i - 1) / 2] < ~value;
+	     i = (i - 1) / 2)
+		top->array[i] = top->array[(i - 1) / 2];
+	top->array[i] = ~value;
+
+	return (1);
+}
+
+/**
+ * top_k_push_batch - Offers a batch of values to a top-k collector.
+ * The threshold is kept in a local between values, so the common case
+ * of a rejected value is a single comparison.
+ *
+ * @top: A pointer to the collector.
+ * @values: A pointer to the values to offer.
+ * @n: The number of values.
+ *
+ * Return: The number of values that were kept.
+ */
+size_t top_k_push_batch(top_k_t *top, const int *values, size_t n)
+{
+	size_t i, kept = 0;
+	int threshold = 0;
+
+	if (!top || !values)
+		return (0);
+
+	/* The collector may already be full from an earlier call */
+	if (top->size > 0)
+		threshold = ~top->array[0];
+	for (i = 0; i < n; i++)
+	{
+		if (top->size == top->k && values[i] <= threshold)
+			continue;
+		kept += top_k_push(top, values[i]);
+		threshold = ~top->array[0];
+	}
+
+	return (kept);
+}
@@ -0,0 +1,43 @@
+#include "binary_trees.h"
+
+/**
+ * top_k_sorted - Returns the values kept by a top-k collector, sorted.
+ * The heap is copied and the copy is drained in place: swapping the
+ * root with the last value of the shrinking heap leaves the smallest
+ * value last, then the values are complemented back, in descending
+ * order like heap_to_sorted_array. The collector is left untouched and
+ * can keep consuming the stream.
+ *
+ * @top: A pointer to the collector.
+ * @size: A pointer to a variable to store the size of the array.
+ *
+ * Return: A pointer to the sorted array, or NULL if the collector is
+ * empty or on failure.
+ */
+int *top_k_sorted(const top_k_t *top, size_t *size)
+{
+	int *array, min;
+	size_t end;
+
+	*size = 0;
+	if (!top || top->size == 0)
+		return (NULL);
+
+	array = malloc(sizeof(*array) * top->size);
+	if (!array)
+		return (NULL);
+	memcpy(array, top->array, sizeof(*array) * top->size);
+
+	for (end = top->size; end > 1; end--)
+	{
+		min = array[0];
+		array[0] = array[end - 1];
+		array[end - 1] = min;
+		array_heap_sift_down(array, end - 1, 0);
+	}
+	for (end = 0; end < top->size; end++)
+		array[end] = ~array[end];
+	*size = top->size;
+
+	return (array);
+}
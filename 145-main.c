@@ -0,0 +1,40 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	radix_heap_t *heap;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95, -5, INT_MIN, INT_MAX
+	};
+	size_t i, n = sizeof(array) / sizeof(array[0]);
+	int value;
+
+	heap = radix_heap_create();
+	if (!heap)
+		return (1);
+	for (i = 0; i < n; i++)
+		radix_heap_insert(heap, array[i]);
+	for (i = 0; i < 5; i++)
+		printf("%d ", radix_heap_extract(heap));
+	printf("\n");
+
+	printf("Insert 1 after 20: %d\n", radix_heap_insert(heap, 1));
+	printf("Insert 20 after 20: %d\n", radix_heap_insert(heap, 20));
+	printf("Insert 50 after 20: %d\n", radix_heap_insert(heap, 50));
+	while (heap->size)
+	{
+		value = radix_heap_extract(heap);
+		printf("%d ", value);
+	}
+	printf("\n");
+	radix_heap_delete(heap);
+	return (0);
+}
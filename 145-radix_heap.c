@@ -0,0 +1,107 @@
+#include "binary_trees.h"
+
+/**
+ * radix_heap_create - Creates an empty radix heap.
+ * A radix heap is a min-priority queue for monotone workloads: a value
+ * may only be inserted if it is not lower than the last extracted one.
+ * Values are filed in buckets by the highest bit where they differ from
+ * the last extracted value, and each value moves to a lower bucket at
+ * most 32 times over its life, so insert and extract are amortized O(1).
+ *
+ * Return: A pointer to the new heap, or NULL on failure.
+ */
+radix_heap_t *radix_heap_create(void)
+{
+	radix_heap_t *heap;
+	size_t i;
+
+	heap = malloc(sizeof(*heap));
+	if (!heap)
+		return (NULL);
+
+	for (i = 0; i < RADIX_HEAP_BUCKETS; i++)
+	{
+		heap->buckets[i].keys = NULL;
+		heap->buckets[i].size = 0;
+		heap->buckets[i].capacity = 0;
+	}
+	heap->last = 0;
+	heap->size = 0;
+
+	return (heap);
+}
+
+/**
+ * radix_heap_delete - Deletes a radix heap.
+ *
+ * @heap: A pointer to the heap to delete.
+ */
+void radix_heap_delete(radix_heap_t *heap)
+{
+	size_t i;
+
+	if (!heap)
+		return;
+
+	for (i = 0; i < RADIX_HEAP_BUCKETS; i++)
+		free(heap->buckets[i].keys);
+	free(heap);
+}
+
+/**
+ * radix_heap_bucket - Finds the bucket of a key.
+ *
+ * @key: The key, as an order-preserving unsigned value.
+ * @last: The last extracted key, as an order-preserving unsigned value.
+ *
+ * Return: 0 if @key equals @last, otherwise 1 + the index of the highest
+ * bit where they differ.
+ */
+size_t radix_heap_bucket(unsigned int key, unsigned int last)
+{
+	if (key == last)
+		return (0);
+
+	return (sizeof(unsigned int) * CHAR_BIT - __builtin_clz(key ^ last));
+}
+
+/**
+ * radix_bucket_push - Appends a key to a bucket of a radix heap.
+ *
+ * @bucket: A pointer to the bucket.
+ * @key: The key to append.
+ *
+ * Return: 1 on success, 0 on failure.
+ */
+int radix_bucket_push(radix_bucket_t *bucket, unsigned int key)
+{
+	if (!radix_bucket_reserve(bucket, bucket->size + 1))
+		return (0);
+	bucket->keys[bucket->size++] = key;
+
+	return (1);
+}
+
+/**
+ * radix_heap_insert - Inserts a value into a radix heap.
+ *
+ * @heap: A pointer to the heap.
+ * @value: The value to insert, not lower than the last extracted value.
+ *
+ * Return: 1 on success, 0 if the value breaks monotonicity or on failure.
+ */
+int radix_heap_insert(radix_heap_t *heap, int value)
+{
+	unsigned int key = RADIX_HEAP_KEY(value);
+	radix_bucket_t *bucket;
+
+	if (!heap || key < heap->last)
+		return (0);
+
+	bucket = &heap->buckets[radix_heap_bucket(key, heap->last)];
+	if (!radix_bucket_push(bucket, key))
+		return (0);
+	heap->size++;
+
+	return (1);
+}
@@ -0,0 +1,98 @@
+#include "binary_trees.h"
+
+/**
+ * radix_bucket_reserve - Makes room for keys in a bucket of a radix heap.
+ *
+ * @bucket: A pointer to the bucket.
+ * @needed: The number of keys the bucket must be able to hold.
+ *
+ * Return: 1 on success, 0 on failure.
+ */
+int radix_bucket_reserve(radix_bucket_t *bucket, size_t needed)
+{
+	unsigned int *keys;
+	size_t capacity;
+
+	if (needed <= bucket->capacity)
+		return (1);
+
+	capacity = bucket->capacity ? bucket->capacity * 2 : 16;
+	if (capacity < needed)
+		capacity = needed;
+	keys = realloc(bucket->keys, sizeof(*keys) * capacity);
+	if (!keys)
+		return (0);
+	bucket->keys = keys;
+	bucket->capacity = capacity;
+
+	return (1);
+}
+
+/**
+ * radix_heap_refill - Refills the first bucket of a radix heap.
+ * The lowest non-empty bucket holds the minimum, which becomes the new
+ * last extracted key. All the keys of that bucket then share more high
+ * bits with it, so they all move to strictly lower buckets, the minimum
+ * itself landing in bucket 0. Room is reserved in the lower buckets
+ * before any key moves, so a failed allocation leaves the heap intact.
+ *
+ * @heap: A pointer to a non-empty heap whose bucket 0 is empty.
+ *
+ * Return: 1 on success, 0 on failure.
+ */
+int radix_heap_refill(radix_heap_t *heap)
+{
+	size_t counts[RADIX_HEAP_BUCKETS] = {0};
+	radix_bucket_t *bucket, *target;
+	size_t i, b;
+	unsigned int min, key;
+
+	for (b = 1; heap->buckets[b].size == 0; b++)
+		;
+	bucket = &heap->buckets[b];
+
+	for (min = bucket->keys[0], i = 1; i < bucket->size; i++)
+		if (bucket->keys[i] < min)
+			min = bucket->keys[i];
+
+	for (i = 0; i < bucket->size; i++)
+		counts[radix_heap_bucket(bucket->keys[i], min)]++;
+	for (i = 0; i < b; i++)
+		if (!radix_bucket_reserve(&heap->buckets[i],
+					  heap->buckets[i].size + counts[i]))
+			return (0);
+
+	heap->last = min;
+	for (i = 0; i < bucket->size; i++)
+	{
+		key = bucket->keys[i];
+		target = &heap->buckets[radix_heap_bucket(key, min)];
+		radix_bucket_push(target, key);
+	}
+	bucket->size = 0;
+
+	return (1);
+}
+
+/**
+ * radix_heap_extract - Extracts the minimum of a radix heap.
+ *
+ * @heap: A pointer to the heap.
+ *
+ * Return: The minimum value, or 0 if the heap is empty or on failure.
+ */
+int radix_heap_extract(radix_heap_t *heap)
+{
+	unsigned int key;
+
+	if (!heap || heap->size == 0)
+		return (0);
+
+	if (heap->buckets[0].size == 0 && !radix_heap_refill(heap))
+		return (0);
+
+	key = heap->buckets[0].keys[--heap->buckets[0].size];
+	heap->size--;
+
+	return (RADIX_HEAP_VALUE(key));
+}
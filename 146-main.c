@@ -0,0 +1,36 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	minmax_heap_t *heap;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t n = sizeof(array) / sizeof(array[0]);
+
+	heap = array_to_minmax_heap(array, n);
+	if (!heap)
+		return (1);
+	printf("Min: %d, Max: %d\n", minmax_heap_peek_min(heap),
+	       minmax_heap_peek_max(heap));
+	printf("Extract max: %d\n", minmax_heap_extract_max(heap));
+	printf("Extract min: %d\n", minmax_heap_extract_min(heap));
+	minmax_heap_insert(heap, 100);
+	minmax_heap_insert(heap, 0);
+	while (heap->size > 1)
+	{
+		printf("%d/", minmax_heap_extract_min(heap));
+		printf("%d ", minmax_heap_extract_max(heap));
+	}
+	printf("\n");
+	minmax_heap_delete(heap);
+	return (0);
+}
@@ -0,0 +1,131 @@
+#include "binary_trees.h"
+
+/**
+ * minmax_heap_create - Creates an empty min-max heap.
+ * A min-max heap is a level-order array where values on even levels are
+ * lower than all their descendants and values on odd levels are greater
+ * than all their descendants. The minimum is at the root and the
+ * maximum is one of its children, so both ends can be read in O(1) and
+ * extracted in O(log n) from a single structure.
+ *
+ * @capacity: The number of values to reserve room for, 0 for a default.
+ *
+ * Return: A pointer to the new heap, or NULL on failure.
+ */
+minmax_heap_t *minmax_heap_create(size_t capacity)
+{
+	minmax_heap_t *heap;
+
+	if (capacity == 0)
+		capacity = 16;
+
+	heap = malloc(sizeof(*heap));
+	if (!heap)
+		return (NULL);
+
+	heap->array = malloc(sizeof(*heap->array) * capacity);
+	if (!heap->array)
+	{
+		free(heap);
+		return (NULL);
+	}
+	heap->size = 0;
+	heap->capacity = capacity;
+
+	return (heap);
+}
+
+/**
+ * minmax_heap_delete - Deletes a min-max heap.
+ *
+ * @heap: A pointer to the heap to delete.
+ */
+void minmax_heap_delete(minmax_heap_t *heap)
+{
+	if (!heap)
+		return;
+
+	free(heap->array);
+	free(heap);
+}
+
+/**
+ * minmax_is_max_level - Checks if a slot of a min-max heap is on a max level.
+ *
+ * @i: The index of the slot.
+ *
+ * Return: 1 if the slot is on an odd (max) level, 0 otherwise.
+ */
+int minmax_is_max_level(size_t i)
+{
+	int level = 0;
+
+	for (i++; i > 1; i >>= 1)
+		level++;
+
+	return (level % 2);
+}
+
+/**
+ * minmax_bubble_up - Moves a value up a min-max heap.
+ * The value is first put on the right kind of level by comparing it with
+ * its parent, then moved up that kind of levels only, from grandparent
+ * to grandparent.
+ *
+ * @array: A pointer to the heap array.
+ * @i: The index of the value to move up.
+ */
+void minmax_bubble_up(int *array, size_t i)
+{
+	int value = array[i], max = minmax_is_max_level(i);
+	size_t parent;
+
+	if (i > 0 && (max ? value < array[(i - 1) / 2] :
+		      value > array[(i - 1) / 2]))
+	{
+		parent = (i - 1) / 2;
+		array[i] = array[parent];
+		i = parent;
+		max = !max;
+	}
+
+	while (i > 2)
+	{
+		parent = ((i - 1) / 2 - 1) / 2;
+		if (max ? value <= array[parent] : value >= array[parent])
+			break;
+		array[i] = array[parent];
+		i = parent;
+	}
+	array[i] = value;
+}
+
+/**
+ * minmax_heap_insert - Inserts a value into a min-max heap in O(log n).
+ *
+ * @heap: A pointer to the heap.
+ * @value: The value to insert.
+ *
+ * Return: 1 on success, 0 on failure.
+ */
+int minmax_heap_insert(minmax_heap_t *heap, int value)
+{
+	int *array;
+
+	if (!heap)
+		return (0);
+
+	if (heap->size == heap->capacity)
+	{
+		array = realloc(heap->array,
+				sizeof(*array) * heap->capacity * 2);
+		if (!array)
+			return (0);
+		heap->array = array;
+		heap->capacity *= 2;
+	}
+	heap->array[heap->size] = value;
+	minmax_bubble_up(heap->array, heap->size++);
+
+	return (1);
+}
@@ -0,0 +1,78 @@
+#include "binary_trees.h"
+
+/**
+ * minmax_heap_max_index - Finds the slot of the maximum of a min-max heap.
+ *
+ * @heap: A pointer to a non-empty heap.
+ *
+ * Return: The index of the maximum, the root or one of its children.
+ */
+size_t minmax_heap_max_index(const minmax_heap_t *heap)
+{
+	if (heap->size == 1)
+		return (0);
+	if (heap->size == 2 || heap->array[1] >= heap->array[2])
+		return (1);
+
+	return (2);
+}
+
+/**
+ * minmax_heap_peek_min - Returns the minimum of a min-max heap in O(1).
+ *
+ * @heap: A pointer to the heap.
+ *
+ * Return: The minimum value, or 0 if the heap is empty.
+ */
+int minmax_heap_peek_min(const minmax_heap_t *heap)
+{
+	if (!heap || heap->size == 0)
+		return (0);
+
+	return (heap->array[0]);
+}
+
+/**
+ * minmax_heap_peek_max - Returns the maximum of a min-max heap in O(1).
+ *
+ * @heap: A pointer to the heap.
+ *
+ * Return: The maximum value, or 0 if the heap is empty.
+ */
+int minmax_heap_peek_max(const minmax_heap_t *heap)
+{
+	if (!heap || heap->size == 0)
+		return (0);
+
+	return (heap->array[minmax_heap_max_index(heap)]);
+}
+
+/**
+ * array_to_minmax_heap - Builds a min-max heap from an array in O(n).
+ * Like array_heapify, the values are trickled down from the last parent
+ * back to the root.
+ *
+ * @array: A pointer to the array of integers.
+ * @size: The number of elements in the array.
+ *
+ * Return: A pointer to the new heap, or NULL on failure.
+ */
+minmax_heap_t *array_to_minmax_heap(const int *array, size_t size)
+{
+	minmax_heap_t *heap;
+	size_t i;
+
+	if (!array || size == 0)
+		return (NULL);
+
+	heap = minmax_heap_create(size);
+	if (!heap)
+		return (NULL);
+
+	memcpy(heap->array, array, sizeof(*array) * size);
+	heap->size = size;
+	for (i = size / 2; i > 0; i--)
+		minmax_trickle_down(heap->array, size, i - 1);
+
+	return (heap);
+}
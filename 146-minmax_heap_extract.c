@@ -0,0 +1,120 @@
+#include "binary_trees.h"
+
+/**
+ * minmax_best_descendant - Finds the extreme value below a slot.
+ * Only the children and grandchildren of the slot need to be checked.
+ *
+ * @array: A pointer to the heap array.
+ * @size: The number of values in the heap.
+ * @i: The index of the slot.
+ * @max: 1 to look for the greatest value, 0 for the lowest.
+ *
+ * Return: The index of the extreme child or grandchild, or @i if the
+ * slot has no child.
+ */
+size_t minmax_best_descendant(const int *array, size_t size, size_t i,
+			      int max)
+{
+	size_t best = i, j, candidates[6];
+	size_t k, count = 0;
+
+	for (j = 2 * i + 1; j <= 2 * i + 2 && j < size; j++)
+	{
+		candidates[count++] = j;
+		for (k = 2 * j + 1; k <= 2 * j + 2 && k < size; k++)
+			candidates[count++] = k;
+	}
+	for (k = 0; k < count; k++)
+	{
+		j = candidates[k];
+		if (best == i || (max ? array[j] > array[best] :
+				  array[j] < array[best]))
+			best = j;
+	}
+
+	return (best);
+}
+
+/**
+ * minmax_trickle_down - Moves a value down a min-max heap.
+ * On a min level the value swaps with the lowest of its children and
+ * grandchildren while that one is lower (and the other way round on a
+ * max level). When it moves two levels down, it is also compared with
+ * its new parent, which is on the other kind of level.
+ *
+ * @array: A pointer to the heap array.
+ * @size: The number of values in the heap.
+ * @i: The index of the value to move down.
+ */
+void minmax_trickle_down(int *array, size_t size, size_t i)
+{
+	int max = minmax_is_max_level(i), tmp;
+	size_t m, parent;
+
+	while ((m = minmax_best_descendant(array, size, i, max)) != i)
+	{
+		if (max ? array[m] <= array[i] : array[m] >= array[i])
+			break;
+		tmp = array[m], array[m] = array[i], array[i] = tmp;
+		if (m <= 2 * i + 2)
+			break;
+
+		/* Moved to a grandchild: keep it in order with its parent */
+		parent = (m - 1) / 2;
+		if (max ? array[m] < array[parent] : array[m] > array[parent])
+		{
+			tmp = array[m], array[m] = array[parent];
+			array[parent] = tmp;
+		}
+		i = m;
+	}
+}
+
+/**
+ * minmax_heap_remove_at - Removes the value at a slot of a min-max heap.
+ *
+ * @heap: A pointer to a non-empty heap.
+ * @i: The index of the value to remove.
+ *
+ * Return: The removed value.
+ */
+int minmax_heap_remove_at(minmax_heap_t *heap, size_t i)
+{
+	int value = heap->array[i];
+
+	heap->array[i] = heap->array[--heap->size];
+	if (i < heap->size)
+		minmax_trickle_down(heap->array, heap->size, i);
+
+	return (value);
+}
+
+/**
+ * minmax_heap_extract_min - Extracts the minimum of a min-max heap.
+ *
+ * @heap: A pointer to the heap.
+ *
+ * Return: The minimum value, or 0 if the heap is empty.
+ */
+int minmax_heap_extract_min(minmax_heap_t *heap)
+{
+	if (!heap || heap->size == 0)
+		return (0);
+
+	return (minmax_heap_remove_at(heap, 0));
+}
+
+/**
+ * minmax_heap_extract_max - Extracts the maximum of a min-max heap.
+ *
+ * @heap: A pointer to the heap.
+ *
+ * Return: The maximum value, or 0 if the heap is empty.
+ */
+int minmax_heap_extract_max(minmax_heap_t *heap)
+{
+	if (!heap || heap->size == 0)
+		return (0);
+
+	return (minmax_heap_remove_at(heap, minmax_heap_max_index(heap)));
+}
@@ -0,0 +1,88 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * now - Returns the wall-clock time, since clock() adds up all threads
+ *
+ * Return: The time in seconds
+ */
+double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * bench_threads - Times the parallel heapify and sort with n threads
+ *
+ * @keys: The values to work on
+ * @work: Scratch buffer of the same size
+ * @size: Number of values
+ * @threads: Number of threads
+ * @base: Times with 1 thread, filled in when @threads is 1
+ */
+void bench_threads(const int *keys, int *work, size_t size, size_t threads,
+		   double *base)
+{
+	double start, heapify, sort;
+
+	memcpy(work, keys, sizeof(*keys) * size);
+	start = now();
+	array_heapify_parallel(work, size, threads);
+	heapify = now() - start;
+
+	memcpy(work, keys, sizeof(*keys) * size);
+	start = now();
+	heap_sort_parallel(work, size, threads);
+	sort = now() - start;
+
+	if (threads == 1)
+		base[0] = heapify, base[1] = sort;
+	printf("  %3lu threads: heapify %.3fs (x%.2f)  sort %.3fs (x%.2f)\n",
+	       (unsigned long)threads, heapify, base[0] / heapify,
+	       sort, base[1] / sort);
+}
+
+/**
+ * main - Benchmarks the parallel heapify and heap sort from 1 thread up
+ * to the number given as argument (default one per CPU), doubling at
+ * each step
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments, argv[1] being the number of values (default 10M)
+ * and argv[2] the largest number of threads
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int argc, char **argv)
+{
+	size_t i, size = argc > 1 ? strtoul(argv[1], NULL, 10) : 10000000;
+	size_t max = heap_parallel_threads(argc > 2 ?
+					   strtoul(argv[2], NULL, 10) : 0);
+	double base[2];
+	int *keys, *work;
+
+	keys = malloc(sizeof(*keys) * size);
+	work = malloc(sizeof(*work) * size);
+	if (!keys || !work)
+		return (1);
+	srand(98);
+	for (i = 0; i < size; i++)
+		keys[i] = rand();
+	printf("%lu values\n", (unsigned long)size);
+	for (i = 1; ; i *= 2)
+	{
+		if (i > max)
+			i = max;
+		bench_threads(keys, work, size, i, base);
+		if (i == max)
+			break;
+	}
+	free(keys);
+	free(work);
+	return (0);
+}
@@ -0,0 +1,174 @@
+#include "binary_trees.h"
+
+/**
+ * heap_merge_lower_bound - Finds the first value of a sorted range that
+ * is not less than a given value.
+ *
+ * @array: A pointer to the array holding the range.
+ * @first: The index of the first slot of the range.
+ * @end: The index one past the last slot of the range.
+ * @value: The value to search for.
+ *
+ * Return: The index of the first slot holding a value not less than
+ * @value, or @end if there is none.
+ */
+size_t heap_merge_lower_bound(const int *array, size_t first, size_t end,
+			      int value)
+{
+	size_t middle;
+
+	while (first < end)
+	{
+		middle = first + (end - first) / 2;
+		if (array[middle] < value)
+			first = middle + 1;
+		else
+			end = middle;
+	}
+
+	return (first);
+}
+
+/**
+ * heap_merge_splitters - Samples the splitters of a parallel merge.
+ * Each run gives parts - 1 evenly spaced values, and the sorted samples
+ * are cut into @parts equal groups: the values of the runs fall close to
+ * evenly between consecutive splitters.
+ *
+ * @array: A pointer to the array holding the sorted runs.
+ * @runs: A pointer to the tasks giving the range of each run.
+ * @count: The number of runs.
+ * @parts: The number of parts of the merge, at least 2.
+ * @splitters: A pointer to room for @count * (@parts - 1) samples,
+ * holding the @parts - 1 splitters in ascending order on return.
+ */
+void heap_merge_splitters(const int *array, const heap_task_t *runs,
+			  size_t count, size_t parts, int *splitters)
+{
+	size_t r, j, samples = 0;
+
+	for (r = 0; r < count; r++)
+		for (j = 1; runs[r].count > 0 && j < parts; j++)
+			splitters[samples++] = array[runs[r].first +
+						     runs[r].count * j / parts];
+	heap_sort_array(splitters, samples, 0);
+	for (j = 1; j < parts; j++)
+		splitters[j - 1] = splitters[samples * j / parts];
+}
+
+/**
+ * heap_merge_split - Cuts sorted runs into the shares of a parallel merge.
+ * Part t takes from every run the values not less than splitter t - 1
+ * and less than splitter t, found by binary search, so the parts hold
+ * consecutive ranges of the merged output.
+ *
+ * @array: A pointer to the array holding the sorted runs.
+ * @runs: A pointer to the tasks giving the range of each run.
+ * @count: The number of runs.
+ * @splitters: A pointer to the @parts - 1 splitters, in ascending order.
+ * @parts: A pointer to the tasks of the parts, @runs of each pointing to
+ * room for @count tasks, which receive its range of every run.
+ * @part_count: The number of parts.
+ */
+void heap_merge_split(int *array, const heap_task_t *runs, size_t count,
+		      const int *splitters, heap_task_t *parts,
+		      size_t part_count)
+{
+	heap_task_t *share;
+	size_t t, r, end, offset = 0;
+
+	for (t = 0; t < part_count; t++)
+	{
+		parts[t].first = offset;
+		parts[t].count = 0;
+		for (r = 0; r < count; r++)
+		{
+			share = parts[t].runs + r;
+			share->array = array;
+			share->size = runs[r].size;
+			share->first = t ? parts[t - 1].runs[r].first +
+					   parts[t - 1].runs[r].count
+					 : runs[r].first;
+			end = runs[r].first + runs[r].count;
+			if (t + 1 < part_count)
+				end = heap_merge_lower_bound(array,
+							     share->first, end,
+							     splitters[t]);
+			share->count = end - share->first;
+			parts[t].count += share->count;
+		}
+		offset += parts[t].count;
+	}
+}
+
+/**
+ * heap_merge_part - Merges the share of the runs of one part.
+ *
+ * @arg: A pointer to the heap_task_t of the part, @array being the output
+ * buffer, set to NULL on failure, and @first and @count the range of the
+ * part in it.
+ *
+ * Return: Always NULL.
+ */
+void *heap_merge_part(void *arg)
+{
+	heap_task_t *task = arg;
+
+	if (!heap_merge_runs(task->runs->array, task->runs, task->run_count,
+			     task->array + task->first))
+		task->array = NULL;
+
+	return (NULL);
+}
+
+/**
+ * heap_merge_parallel - Merges sorted runs with threads.
+ * The runs are cut at sampled splitters into one part per thread, each
+ * part being merged by heap_merge_runs straight to its place in the
+ * output, so the merge costs O(n log k / threads) plus the cut.
+ *
+ * @array: A pointer to the array holding the sorted runs, back to back.
+ * @runs: A pointer to the tasks giving the range of each run.
+ * @count: The number of runs.
+ * @out: A pointer to the buffer to write the merged values to.
+ * @threads: The number of threads to use.
+ *
+ * Return: 1 on success, 0 on failure.
+ */
+int heap_merge_parallel(int *array, const heap_task_t *runs, size_t count,
+			int *out, size_t threads)
+{
+	heap_task_t parts[HEAP_PARALLEL_MAX_THREADS], *shares;
+	int *splitters, merged = 1;
+	size_t t, size = 0;
+
+	for (t = 0; t < count; t++)
+		size += runs[t].count;
+	if (threads > HEAP_PARALLEL_MAX_THREADS)
+		threads = HEAP_PARALLEL_MAX_THREADS;
+	if (threads < 2 || size == 0)
+		return (heap_merge_runs(array, runs, count, out));
+
+	shares = malloc(sizeof(*shares) * threads * count +
+			sizeof(*splitters) * count * (threads - 1));
+	if (!shares)
+		return (0);
+	splitters = (int *)(shares + threads * count);
+
+	for (t = 0; t < threads; t++)
+	{
+		parts[t].array = out;
+		parts[t].size = size;
+		parts[t].runs = shares + t * count;
+		parts[t].run_count = count;
+	}
+	heap_merge_splitters(array, runs, count, threads, splitters);
+	heap_merge_split(array, runs, count, splitters, parts, threads);
+	heap_parallel_run(parts, threads, heap_merge_part);
+	for (t = 0; t < threads; t++)
+		if (!parts[t].array)
+			merged = 0;
+	free(shares);
+
+	return (merged);
+}
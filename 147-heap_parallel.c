@@ -0,0 +1,154 @@
+#include "binary_trees.h"
+
+/**
+ * heap_parallel_threads - Resolves the number of threads to run.
+ *
+ * @threads: The number of threads requested, 0 for one per online CPU.
+ *
+ * Return: The number of threads to run, at least 1.
+ */
+size_t heap_parallel_threads(size_t threads)
+{
+	long cpus;
+
+	if (threads == 0)
+	{
+		cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		threads = cpus > 0 ? (size_t)cpus : 1;
+	}
+
+	return (threads);
+}
+
+/**
+ * heap_parallel_run - Runs a worker on each task, one thread per task.
+ * The first task runs on the calling thread. A task whose thread cannot
+ * be created also runs on the calling thread, so the work is always done.
+ *
+ * @tasks: A pointer to the array of tasks.
+ * @count: The number of tasks.
+ * @worker: The function to run on each task.
+ */
+void heap_parallel_run(heap_task_t *tasks, size_t count,
+		       void *(*worker)(void *))
+{
+	pthread_t *threads;
+	char *started;
+	size_t i;
+
+	threads = malloc((sizeof(*threads) + 1) * count);
+	started = threads ? (char *)(threads + count) : NULL;
+	for (i = 1; i < count; i++)
+	{
+		if (started)
+			started[i] = !pthread_create(threads + i, NULL,
+						     worker, tasks + i);
+		if (!started || !started[i])
+			worker(tasks + i);
+	}
+	worker(tasks);
+	for (i = 1; started && i < count; i++)
+		if (started[i])
+			pthread_join(threads[i], NULL);
+	free(threads);
+}
+
+/**
+ * heap_heapify_subtrees - Heapifies consecutive subtrees of a heap array.
+ * The roots of the subtrees are consecutive slots of one level, so their
+ * descendants on each level below also are: every level is swept as one
+ * range, from the bottom up, as array_heapify does for the whole array.
+ *
+ * @arg: A pointer to the heap_task_t, @first and @count being the range
+ * of the subtree roots.
+ *
+ * Return: Always NULL.
+ */
+void *heap_heapify_subtrees(void *arg)
+{
+	heap_task_t *task = arg;
+	size_t depth, lo, hi, parents = task->size / 2;
+
+	for (depth = 0; ((task->first + 1) << (depth + 1)) - 1 < task->size;)
+		depth++;
+	for (depth++; depth > 0; depth--)
+	{
+		lo = ((task->first + 1) << (depth - 1)) - 1;
+		hi = ((task->first + task->count + 1) << (depth - 1)) - 1;
+		for (hi = hi < parents ? hi : parents; hi > lo; hi--)
+			array_heap_sift_down(task->array, task->size, hi - 1);
+	}
+
+	return (NULL);
+}
+
+/**
+ * array_heapify_parallel - Turns an array into a max-heap with threads.
+ * The first level with at least one subtree per thread is split into
+ * even ranges of subtrees, heapified concurrently since they share no
+ * slot, then the few levels above are finished on the calling thread.
+ * Small arrays are heapified with array_heapify alone.
+ *
+ * @array: A pointer to the array to turn into a heap.
+ * @size: The number of values in the array.
+ * @threads: The number of threads to use, 0 for one per online CPU.
+ */
+void array_heapify_parallel(int *array, size_t size, size_t threads)
+{
+	heap_task_t tasks[HEAP_PARALLEL_MAX_THREADS];
+	size_t i, roots = 1;
+
+	threads = heap_parallel_threads(threads);
+	if (threads > HEAP_PARALLEL_MAX_THREADS)
+		threads = HEAP_PARALLEL_MAX_THREADS;
+	if (!array || threads < 2 || size < HEAP_PARALLEL_GRAIN)
+	{
+		array_heapify(array, size);
+		return;
+	}
+
+	while (roots < threads)
+		roots *= 2;
+	for (i = 0; i < threads; i++)
+	{
+		tasks[i].array = array;
+		tasks[i].size = size;
+		tasks[i].first = roots * i / threads;
+		tasks[i].count = roots * (i + 1) / threads - tasks[i].first;
+		tasks[i].first += roots - 1;
+	}
+	heap_parallel_run(tasks, threads, heap_heapify_subtrees);
+	for (i = roots - 1; i > 0; i--)
+		array_heap_sift_down(array, size, i - 1);
+}
+
+/**
+ * array_to_heap_parallel - Builds a pointer max-heap from an array.
+ * This is array_to_heap_bottom_up with the heapify step spread over
+ * several threads.
+ *
+ * @array: A pointer to the array of integers.
+ * @size: The number of elements in the array.
+ * @threads: The number of threads to use, 0 for one per online CPU.
+ *
+ * Return: A pointer to the root node of the heap, or NULL on failure.
+ */
+heap_t *array_to_heap_parallel(int *array, size_t size, size_t threads)
+{
+	heap_t *tree;
+	int *scratch;
+
+	if (!array || size == 0)
+		return (NULL);
+
+	scratch = malloc(sizeof(*scratch) * size);
+	if (!scratch)
+		return (NULL);
+
+	memcpy(scratch, array, sizeof(*array) * size);
+	array_heapify_parallel(scratch, size, threads);
+	tree = array_heap_build_tree(NULL, scratch, size, 0);
+	free(scratch);
+
+	return (tree);
+}
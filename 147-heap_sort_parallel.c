@@ -0,0 +1,141 @@
+#include "binary_trees.h"
+
+/**
+ * heap_sort_chunk - Sorts one chunk of an array in ascending order.
+ *
+ * @arg: A pointer to the heap_task_t, @first and @count being the range
+ * of the chunk.
+ *
+ * Return: Always NULL.
+ */
+void *heap_sort_chunk(void *arg)
+{
+	heap_task_t *task = arg;
+
+	heap_sort_array(task->array + task->first, task->count, 0);
+
+	return (NULL);
+}
+
+/**
+ * heap_merge_sift_down - Moves a run down the min-heap of a k-way merge.
+ * The runs are ordered by their next value.
+ *
+ * @array: A pointer to the array holding the runs.
+ * @heap: A pointer to the min-heap of runs, in level order.
+ * @next: A pointer to the index of the next value of each run.
+ * @size: The number of runs in the heap.
+ * @i: The index of the run to move down.
+ */
+void heap_merge_sift_down(const int *array, size_t *heap, const size_t *next,
+			  size_t size, size_t i)
+{
+	size_t run = heap[i], child;
+	int value = array[next[run]];
+
+	while ((child = 2 * i + 1) < size)
+	{
+		if (child + 1 < size &&
+		    array[next[heap[child + 1]]] < array[next[heap[child]]])
+			child++;
+		if (array[next[heap[child]]] >= value)
+			break;
+		heap[i] = heap[child];
+		i = child;
+	}
+	heap[i] = run;
+}
+
+/**
+ * heap_merge_runs - Merges sorted runs with a heap of their heads.
+ * Each step outputs the head of the run at the root of the min-heap, then
+ * repairs the heap in O(log k), or drops the run when it is exhausted.
+ *
+ * @array: A pointer to the array holding the sorted runs, back to back.
+ * @tasks: A pointer to the tasks giving the range of each run.
+ * @runs: The number of runs.
+ * @out: A pointer to the buffer to write the merged values to.
+ *
+ * Return: 1 on success, 0 on failure.
+ */
+int heap_merge_runs(const int *array, const heap_task_t *tasks, size_t runs,
+		    int *out)
+{
+	size_t *heap, *next, size = 0, i, run;
+
+	heap = malloc(sizeof(*heap) * runs * 2);
+	if (!heap)
+		return (0);
+	next = heap + runs;
+
+	for (i = 0; i < runs; i++)
+	{
+		next[i] = tasks[i].first;
+		if (tasks[i].count > 0)
+			heap[size++] = i;
+	}
+	for (i = size / 2; i > 0; i--)
+		heap_merge_sift_down(array, heap, next, size, i - 1);
+	while (size > 0)
+	{
+		run = heap[0];
+		*out++ = array[next[run]++];
+		if (next[run] == tasks[run].first + tasks[run].count)
+			heap[0] = heap[--size];
+		if (size > 0)
+			heap_merge_sift_down(array, heap, next, size, 0);
+	}
+	free(heap);
+
+	return (1);
+}
+
+/**
+ * heap_sort_parallel - Sorts an array in ascending order with threads.
+ * The array is split into one chunk per thread, each chunk is heap sorted
+ * concurrently, then the sorted chunks are merged into a scratch buffer,
+ * which is copied back, by heap-based k-way merges of one part each.
+ * Small arrays are sorted with heap_sort_array alone.
+ *
+ * @array: A pointer to the array to sort.
+ * @size: The number of values in the array.
+ * @threads: The number of threads to use, 0 for one per online CPU.
+ *
+ * Return: 1 on success, 0 on failure, the array then not fully sorted.
+ */
+int heap_sort_parallel(int *array, size_t size, size_t threads)
+{
+	heap_task_t tasks[HEAP_PARALLEL_MAX_THREADS];
+	int *scratch;
+	size_t i;
+
+	threads = heap_parallel_threads(threads);
+	if (threads > HEAP_PARALLEL_MAX_THREADS)
+		threads = HEAP_PARALLEL_MAX_THREADS;
+	if (!array || threads < 2 || size < HEAP_PARALLEL_GRAIN)
+	{
+		heap_sort_array(array, size, 0);
+		return (1);
+	}
+
+	scratch = malloc(sizeof(*scratch) * size);
+	if (!scratch)
+		return (0);
+	for (i = 0; i < threads; i++)
+	{
+		tasks[i].array = array;
+		tasks[i].size = size;
+		tasks[i].first = size * i / threads;
+		tasks[i].count = size * (i + 1) / threads - tasks[i].first;
+	}
+	heap_parallel_run(tasks, threads, heap_sort_chunk);
+	if (!heap_merge_parallel(array, tasks, threads, scratch, threads))
+	{
+		free(scratch);
+		return (0);
+	}
+	memcpy(array, scratch, sizeof(*array) * size);
+	free(scratch);
+
+	return (1);
+}
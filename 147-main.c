@@ -0,0 +1,76 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * is_array_heap - Checks that an array is a level-order max-heap
+ *
+ * @array: Pointer to the array
+ * @size: Number of values in the array
+ *
+ * Return: 1 if it is a heap, 0 otherwise
+ */
+int is_array_heap(const int *array, size_t size)
+{
+	size_t i;
+
+	for (i = 1; i < size; i++)
+		if (array[(i - 1) / 2] < array[i])
+			return (0);
+	return (1);
+}
+
+/**
+ * is_sorted - Checks that an array is sorted in ascending order
+ *
+ * @array: Pointer to the array
+ * @size: Number of values in the array
+ *
+ * Return: 1 if it is sorted, 0 otherwise
+ */
+int is_sorted(const int *array, size_t size)
+{
+	size_t i;
+
+	for (i = 1; i < size; i++)
+		if (array[i - 1] > array[i])
+			return (0);
+	return (1);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	heap_t *tree;
+	int array[] = {
+		79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+		20, 22, 98, 1, 62, 95
+	};
+	size_t i, n = sizeof(array) / sizeof(array[0]), big = 1000003;
+	int *values;
+
+	tree = array_to_heap_parallel(array, n, 4);
+	if (!tree)
+		return (1);
+	binary_tree_print(tree);
+	printf("Is heap: %d\n", binary_tree_is_heap(tree));
+	binary_tree_delete(tree);
+
+	values = malloc(sizeof(*values) * big);
+	if (!values)
+		return (1);
+	srand(147);
+	for (i = 0; i < big; i++)
+		values[i] = rand() % 100000;
+	array_heapify_parallel(values, big, 6);
+	printf("Parallel heapify: %d\n", is_array_heap(values, big));
+	if (!heap_sort_parallel(values, big, 6))
+		return (1);
+	printf("Parallel sort: %d\n", is_sorted(values, big));
+	free(values);
+	return (0);
+}
@@ -0,0 +1,130 @@
+#include "binary_trees.h"
+
+/**
+ * loser_tree_create - Creates a loser tree merging sorted sources.
+ * The k sources are the leaves of an implicit tree: leaf i sits at
+ * k + i, and node j has its children at 2j and 2j + 1. Each internal
+ * node keeps the loser of the match played there and node 0 keeps the
+ * overall winner, so replacing the winner replays a single leaf-to-root
+ * path with one comparison per level, whereas a heap compares both
+ * children at each level on the way down.
+ *
+ * @k: The number of sources.
+ * @read: The function reading the next value of a source.
+ * @sources: A pointer to the array of the k sources, passed to @read.
+ *
+ * Return: A pointer to the new loser tree, or NULL on failure.
+ */
+loser_tree_t *loser_tree_create(size_t k, merge_read_t read, void **sources)
+{
+	loser_tree_t *tree;
+	size_t i;
+
+	if (k == 0 || !read || !sources)
+		return (NULL);
+
+	tree = malloc(sizeof(*tree) + k * (sizeof(*tree->nodes) +
+		      sizeof(*tree->sources) + sizeof(*tree->keys) + 1));
+	if (!tree)
+		return (NULL);
+	tree->k = k;
+	tree->read = read;
+	tree->nodes = (size_t *)(tree + 1);
+	tree->sources = (void **)(tree->nodes + k);
+	tree->keys = (int *)(tree->sources + k);
+	tree->done = (char *)(tree->keys + k);
+	for (i = 0; i < k; i++)
+	{
+		tree->sources[i] = sources[i];
+		tree->done[i] = !read(sources[i], tree->keys + i);
+	}
+	loser_tree_build(tree);
+
+	return (tree);
+}
+
+/**
+ * loser_tree_delete - Deletes a loser tree, leaving its sources alone.
+ *
+ * @tree: A pointer to the loser tree to delete.
+ */
+void loser_tree_delete(loser_tree_t *tree)
+{
+	free(tree);
+}
+
+/**
+ * loser_tree_less - Checks if a source comes before another in a merge.
+ * Exhausted sources come last, and equal values come out in the order of
+ * their sources so the merge is stable.
+ *
+ * @tree: A pointer to the loser tree.
+ * @a: The index of the first source.
+ * @b: The index of the second source.
+ *
+ * Return: 1 if source @a wins against source @b, 0 otherwise.
+ */
+int loser_tree_less(const loser_tree_t *tree, size_t a, size_t b)
+{
+	if (tree->done[a] || tree->done[b])
+		return (!tree->done[a]);
+	if (tree->keys[a] != tree->keys[b])
+		return (tree->keys[a] < tree->keys[b]);
+
+	return (a < b);
+}
+
+/**
+ * loser_tree_build - Plays the first round of a loser tree.
+ * Each leaf climbs until it reaches an empty node, where it waits for the
+ * winner of the other subtree. The last leaf to arrive at the top is the
+ * winner, so every node is played exactly once.
+ *
+ * @tree: A pointer to the loser tree.
+ */
+void loser_tree_build(loser_tree_t *tree)
+{
+	size_t i, node, winner, tmp;
+
+	for (node = 0; node < tree->k; node++)
+		tree->nodes[node] = tree->k;
+
+	for (i = 0; i < tree->k; i++)
+	{
+		winner = i;
+		for (node = (tree->k + i) / 2; node > 0; node /= 2)
+		{
+			if (tree->nodes[node] == tree->k)
+				break;
+			if (loser_tree_less(tree, tree->nodes[node], winner))
+			{
+				tmp = tree->nodes[node];
+				tree->nodes[node] = winner;
+				winner = tmp;
+			}
+		}
+		tree->nodes[node] = winner;
+	}
+}
+
+/**
+ * loser_tree_replay - Replays the matches on the path of the winner.
+ * It is called once the winning source has moved to its next value.
+ *
+ * @tree: A pointer to the loser tree.
+ */
+void loser_tree_replay(loser_tree_t *tree)
+{
+	size_t node, winner = tree->nodes[0], tmp;
+
+	for (node = (tree->k + winner) / 2; node > 0; node /= 2)
+	{
+		if (loser_tree_less(tree, tree->nodes[node], winner))
+		{
+			tmp = tree->nodes[node];
+			tree->nodes[node] = winner;
+			winner = tmp;
+		}
+	}
+	tree->nodes[0] = winner;
+}
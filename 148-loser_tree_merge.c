@@ -0,0 +1,139 @@
+#include "binary_trees.h"
+
+/**
+ * loser_tree_pop - Takes the next value out of a loser tree.
+ *
+ * @tree: A pointer to the loser tree.
+ * @value: A pointer to a variable to store the value in.
+ *
+ * Return: 1 if a value was taken, 0 if all the sources are exhausted.
+ */
+int loser_tree_pop(loser_tree_t *tree, int *value)
+{
+	size_t winner;
+
+	if (!tree || tree->done[tree->nodes[0]])
+		return (0);
+
+	winner = tree->nodes[0];
+	*value = tree->keys[winner];
+	tree->done[winner] = !tree->read(tree->sources[winner],
+					 tree->keys + winner);
+	loser_tree_replay(tree);
+
+	return (1);
+}
+
+/**
+ * loser_tree_merge - Streams the merge of all the sources of a loser tree.
+ * The values are handed to @write in chunks of LOSER_TREE_CHUNK, so the
+ * merged stream never has to fit in memory and can go straight to disk.
+ *
+ * @tree: A pointer to the loser tree.
+ * @write: The function receiving each chunk of merged values.
+ * @sink: The first argument passed to @write.
+ *
+ * Return: The number of values merged, or (size_t)-1 if @write failed.
+ */
+size_t loser_tree_merge(loser_tree_t *tree, merge_write_t write, void *sink)
+{
+	int chunk[LOSER_TREE_CHUNK];
+	size_t count = 0, total = 0;
+
+	if (!tree || !write)
+		return (0);
+
+	while (loser_tree_pop(tree, chunk + count))
+	{
+		if (++count == LOSER_TREE_CHUNK)
+		{
+			if (!write(sink, chunk, count))
+				return ((size_t)-1);
+			total += count;
+			count = 0;
+		}
+	}
+	if (count > 0 && !write(sink, chunk, count))
+		return ((size_t)-1);
+
+	return (total + count);
+}
+
+/**
+ * merge_run_read - Reads the next value of an in-memory sorted run.
+ *
+ * @source: A pointer to the merge_run_t.
+ * @value: A pointer to a variable to store the value in.
+ *
+ * Return: 1 if a value was read, 0 at the end of the run.
+ */
+int merge_run_read(void *source, int *value)
+{
+	merge_run_t *run = source;
+
+	if (run->pos == run->size)
+		return (0);
+	*value = run->array[run->pos++];
+
+	return (1);
+}
+
+/**
+ * merge_array_write - Appends merged values to an in-memory buffer.
+ *
+ * @sink: A pointer to the write cursor, an int pointer, moved forward.
+ * @values: A pointer to the values to append.
+ * @count: The number of values to append.
+ *
+ * Return: Always 1.
+ */
+int merge_array_write(void *sink, const int *values, size_t count)
+{
+	int **cursor = sink;
+
+	memcpy(*cursor, values, sizeof(*values) * count);
+	*cursor += count;
+
+	return (1);
+}
+
+/**
+ * merge_sorted_arrays - Merges k sorted arrays into one with a loser tree.
+ *
+ * @arrays: A pointer to the k sorted arrays.
+ * @sizes: A pointer to the k sizes of the arrays.
+ * @k: The number of arrays.
+ * @out: A pointer to a buffer large enough for all the values.
+ *
+ * Return: The number of values merged, or (size_t)-1 on failure.
+ */
+size_t merge_sorted_arrays(const int **arrays, const size_t *sizes, size_t k,
+			   int *out)
+{
+	merge_run_t *runs;
+	loser_tree_t *tree;
+	void **sources;
+	size_t i, total;
+
+	if (!arrays || !sizes || !out || k == 0)
+		return (k == 0 ? 0 : (size_t)-1);
+
+	runs = malloc((sizeof(*runs) + sizeof(*sources)) * k);
+	if (!runs)
+		return ((size_t)-1);
+	sources = (void **)(runs + k);
+	for (i = 0; i < k; i++)
+	{
+		runs[i].array = arrays[i];
+		runs[i].size = sizes[i];
+		runs[i].pos = 0;
+		sources[i] = runs + i;
+	}
+	tree = loser_tree_create(k, merge_run_read, sources);
+	total = tree ? loser_tree_merge(tree, merge_array_write, &out) :
+		(size_t)-1;
+	loser_tree_delete(tree);
+	free(runs);
+
+	return (total);
+}
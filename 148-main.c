@@ -0,0 +1,67 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_chunk - Merge output callback printing each chunk on a line
+ *
+ * @sink: Unused
+ * @values: Values of the chunk
+ * @count: Number of values in the chunk
+ *
+ * Return: Always 1
+ */
+int print_chunk(void *sink, const int *values, size_t count)
+{
+	size_t i;
+
+	(void)sink;
+	for (i = 0; i < count; i++)
+		printf("%s%d", i ? ", " : "", values[i]);
+	printf("\n");
+	return (1);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	int a[] = {2, 21, 47, 79, 91};
+	int b[] = {1, 20, 68, 87};
+	int c[] = {22, 32, 34, 84, 95, 98};
+	int d[] = {21, 62};
+	const int *arrays[5];
+	size_t sizes[5] = {5, 4, 6, 2, 0}, i, n;
+	int out[17];
+	merge_run_t runs[3];
+	void *sources[3];
+	loser_tree_t *tree;
+
+	arrays[0] = a, arrays[1] = b, arrays[2] = c;
+	arrays[3] = d, arrays[4] = NULL;
+	n = merge_sorted_arrays(arrays, sizes, 5, out);
+	if (n == (size_t)-1)
+		return (1);
+	printf("Merged %lu values\n", (unsigned long)n);
+	print_chunk(NULL, out, n);
+
+	for (i = 0; i < 3; i++)
+	{
+		runs[i].array = arrays[i];
+		runs[i].size = sizes[i];
+		runs[i].pos = 0;
+		sources[i] = runs + i;
+	}
+	tree = loser_tree_create(3, merge_run_read, sources);
+	if (!tree)
+		return (1);
+	loser_tree_pop(tree, out);
+	printf("First: %d\n", out[0]);
+	n = loser_tree_merge(tree, print_chunk, NULL);
+	printf("Streamed %lu values\n", (unsigned long)n);
+	loser_tree_delete(tree);
+	return (0);
+}
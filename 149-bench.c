@@ -0,0 +1,80 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * now - Returns the wall-clock time, which includes the file accesses
+ *
+ * Return: The time in seconds
+ */
+double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * write_values - Writes random integers to a file through a large buffer
+ *
+ * @path: Path of the file
+ * @n: Number of values
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int write_values(const char *path, size_t n)
+{
+	FILE *fp = fopen(path, "wb");
+	ext_file_t *file = ext_file_create(fp, EXT_SORT_IO_MAX);
+	size_t i;
+	int value, ok = file != NULL;
+
+	srand(98);
+	for (i = 0; ok && i < n; i++)
+	{
+		value = rand();
+		ok = ext_file_write(file, &value, 1);
+	}
+	ok = ok && ext_file_flush(file);
+	ext_file_delete(file);
+	if (fp && fclose(fp) != 0)
+		ok = 0;
+	return (ok);
+}
+
+/**
+ * main - Benchmarks the external sort of a file of random integers
+ * with memory budgets from 4 MiB up to the one given as argument,
+ * multiplying by 4 at each step
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments, argv[1] being the number of values (default 25M),
+ * argv[2] the largest memory budget in MiB (default 64) and argv[3] the
+ * path of the scratch file (default 149-bench.bin)
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int argc, char **argv)
+{
+	size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 25000000;
+	size_t mib, max = argc > 2 ? strtoul(argv[2], NULL, 10) : 64;
+	const char *path = argc > 3 ? argv[3] : "149-bench.bin";
+	double start, seconds, megabytes = n * sizeof(int) / 1048576.0;
+
+	printf("%lu values (%.0f MiB)\n", (unsigned long)n, megabytes);
+	for (mib = 4; mib <= max; mib *= 4)
+	{
+		if (!write_values(path, n))
+			return (1);
+		start = now();
+		if (!external_sort(path, path, mib << 20))
+			return (1);
+		seconds = now() - start;
+		printf("  %4lu MiB budget: %.3fs, %.1f MiB/s\n",
+		       (unsigned long)mib, seconds, megabytes / seconds);
+	}
+	remove(path);
+	return (0);
+}
@@ -0,0 +1,128 @@
+#include "binary_trees.h"
+
+/**
+ * ext_file_create - Wraps an open file with a large buffer of integers.
+ * Values are read and written a whole buffer at a time, so the file is
+ * accessed in long sequential transfers.
+ *
+ * @fp: The open file, left open by ext_file_delete.
+ * @capacity: The number of values the buffer holds.
+ *
+ * Return: A pointer to the new buffered file, or NULL on failure.
+ */
+ext_file_t *ext_file_create(FILE *fp, size_t capacity)
+{
+	ext_file_t *file;
+
+	if (!fp || capacity == 0)
+		return (NULL);
+
+	file = malloc(sizeof(*file));
+	if (!file)
+		return (NULL);
+
+	file->buffer = malloc(sizeof(*file->buffer) * capacity);
+	if (!file->buffer)
+	{
+		free(file);
+		return (NULL);
+	}
+	file->fp = fp;
+	file->size = 0;
+	file->pos = 0;
+	file->capacity = capacity;
+	file->error = 0;
+
+	return (file);
+}
+
+/**
+ * ext_file_delete - Deletes a buffered file without flushing or closing it.
+ *
+ * @file: A pointer to the buffered file to delete.
+ */
+void ext_file_delete(ext_file_t *file)
+{
+	if (!file)
+		return;
+
+	free(file->buffer);
+	free(file);
+}
+
+/**
+ * ext_file_read - Reads the next integer of a buffered file.
+ * It has the merge_read_t signature so files can feed a loser tree.
+ *
+ * @source: A pointer to the ext_file_t.
+ * @value: A pointer to a variable to store the value in.
+ *
+ * Return: 1 if a value was read, 0 at the end of the file or on error.
+ */
+int ext_file_read(void *source, int *value)
+{
+	ext_file_t *file = source;
+
+	if (file->pos == file->size)
+	{
+		file->size = fread(file->buffer, sizeof(*file->buffer),
+				   file->capacity, file->fp);
+		file->pos = 0;
+		if (file->size == 0)
+		{
+			file->error |= ferror(file->fp) != 0;
+			return (0);
+		}
+	}
+	*value = file->buffer[file->pos++];
+
+	return (1);
+}
+
+/**
+ * ext_file_write - Appends integers to a buffered file.
+ * It has the merge_write_t signature so a loser tree can stream to files.
+ *
+ * @sink: A pointer to the ext_file_t.
+ * @values: A pointer to the values to append.
+ * @count: The number of values to append.
+ *
+ * Return: 1 on success, 0 on write error.
+ */
+int ext_file_write(void *sink, const int *values, size_t count)
+{
+	ext_file_t *file = sink;
+	size_t n;
+
+	while (count > 0)
+	{
+		if (file->size == file->capacity && !ext_file_flush(file))
+			return (0);
+		n = file->capacity - file->size;
+		n = n < count ? n : count;
+		memcpy(file->buffer + file->size, values, sizeof(*values) * n);
+		file->size += n;
+		values += n;
+		count -= n;
+	}
+
+	return (1);
+}
+
+/**
+ * ext_file_flush - Writes out the buffered values of a file.
+ *
+ * @file: A pointer to the buffered file.
+ *
+ * Return: 1 on success, 0 if a write failed.
+ */
+int ext_file_flush(ext_file_t *file)
+{
+	if (file->size > 0 &&
+	    fwrite(file->buffer, sizeof(*file->buffer), file->size,
+		   file->fp) != file->size)
+		file->error = 1;
+	file->size = 0;
+
+	return (!file->error);
+}
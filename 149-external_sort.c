@@ -0,0 +1,98 @@
+#include "binary_trees.h"
+
+/**
+ * ext_sort_merge - Merges the oldest runs of a list with a loser tree.
+ * The merged runs are closed, which deletes their temporary files.
+ *
+ * @runs: A pointer to the list of runs.
+ * @count: The number of runs to merge, from the head of the list.
+ * @fp: The file to write the merged run to.
+ * @io: The number of values in each file buffer.
+ *
+ * Return: 1 on success, 0 on failure.
+ */
+int ext_sort_merge(ext_runs_t *runs, size_t count, FILE *fp, size_t io)
+{
+	loser_tree_t *tree = NULL;
+	ext_file_t *out;
+	void **sources;
+	size_t i;
+	int ok;
+
+	sources = calloc(count, sizeof(*sources));
+	out = ext_file_create(fp, io);
+	ok = sources && out;
+	for (i = 0; ok && i < count; i++)
+	{
+		rewind(runs->files[runs->head + i]);
+		sources[i] = ext_file_create(runs->files[runs->head + i], io);
+		ok = sources[i] != NULL;
+	}
+	if (ok)
+		tree = loser_tree_create(count, ext_file_read, sources);
+	ok = tree && loser_tree_merge(tree, ext_file_write, out) !=
+		(size_t)-1 && ext_file_flush(out);
+	loser_tree_delete(tree);
+	for (i = 0; sources && i < count; i++)
+	{
+		ok = ok && sources[i] && !((ext_file_t *)sources[i])->error;
+		ext_file_delete(sources[i]);
+		fclose(runs->files[runs->head++]);
+	}
+	free(sources);
+	ext_file_delete(out);
+
+	return (ok);
+}
+
+/**
+ * external_sort - Sorts a file of integers larger than memory.
+ * The file holds native ints back to back. Sorted runs are made by
+ * replacement selection in a heap filling the memory budget and spilled
+ * to temporary files, then merged by groups as large as the budget
+ * allows, with one loser tree per group, until one is left: the output.
+ * All the files are accessed through large sequential buffers.
+ *
+ * @input: The path of the file to sort.
+ * @output: The path of the sorted file to write, which may be @input.
+ * @memory: The memory budget in bytes.
+ *
+ * Return: 1 on success, 0 on failure.
+ */
+int external_sort(const char *input, const char *output, size_t memory)
+{
+	ext_runs_t runs = {NULL, 0, 0, 0};
+	size_t io, capacity, fan, budget = memory / sizeof(int);
+	ext_file_t *in;
+	FILE *fp;
+	int *heap, ok;
+
+	io = budget / 16 < EXT_SORT_IO_MIN ? EXT_SORT_IO_MIN : budget / 16;
+	io = io > EXT_SORT_IO_MAX ? EXT_SORT_IO_MAX : io;
+	capacity = budget > 3 * io ? budget - 2 * io : io;
+	fan = budget / io > 3 ? budget / io - 1 : 2;
+
+	fp = fopen(input, "rb");
+	if (!fp)
+		return (0);
+	in = ext_file_create(fp, io);
+	heap = malloc(sizeof(*heap) * capacity);
+	ok = in && heap && ext_sort_runs(in, heap, capacity, &runs, io);
+	free(heap);
+	ext_file_delete(in);
+	fclose(fp);
+
+	while (ok && runs.count - runs.head > fan)
+	{
+		fp = ext_runs_add(&runs);
+		ok = fp && ext_sort_merge(&runs, fan, fp, io);
+	}
+	fp = ok ? fopen(output, "wb") : NULL;
+	ok = fp && (runs.count == runs.head ||
+		    ext_sort_merge(&runs, runs.count - runs.head, fp, io));
+	if (fp && fclose(fp) != 0)
+		ok = 0;
+	ext_runs_close(&runs);
+
+	return (ok);
+}
@@ -0,0 +1,130 @@
+#include "binary_trees.h"
+
+/**
+ * ext_runs_add - Adds an empty temporary file to a list of runs.
+ * The file is removed by the system once it is closed.
+ *
+ * @runs: A pointer to the list of runs.
+ *
+ * Return: A pointer to the new file, or NULL on failure.
+ */
+FILE *ext_runs_add(ext_runs_t *runs)
+{
+	FILE **files;
+
+	if (runs->count == runs->capacity)
+	{
+		files = realloc(runs->files, sizeof(*files) *
+				(runs->capacity ? runs->capacity * 2 : 16));
+		if (!files)
+			return (NULL);
+		runs->files = files;
+		runs->capacity = runs->capacity ? runs->capacity * 2 : 16;
+	}
+	runs->files[runs->count] = tmpfile();
+	if (!runs->files[runs->count])
+		return (NULL);
+
+	return (runs->files[runs->count++]);
+}
+
+/**
+ * ext_runs_close - Closes the runs not merged yet and frees their list.
+ *
+ * @runs: A pointer to the list of runs.
+ */
+void ext_runs_close(ext_runs_t *runs)
+{
+	for (; runs->head < runs->count; runs->head++)
+		fclose(runs->files[runs->head]);
+	free(runs->files);
+	runs->files = NULL;
+	runs->count = runs->head = runs->capacity = 0;
+}
+
+/**
+ * ext_select_pop - Outputs the next value of the current run.
+ * The minimum of the heap is output and replaced with the next input
+ * value. When that value is lower than the one just output, it cannot
+ * join the current run: the heap shrinks by one and the value is put
+ * aside at the end of the buffer for the next run. On random input the
+ * runs are about twice as long as the buffer.
+ *
+ * @sel: A pointer to the replacement selection state.
+ * @value: A pointer to a variable to store the value in.
+ *
+ * Return: 1 if a value was output, 0 if the current run is over.
+ */
+int ext_select_pop(ext_select_t *sel, int *value)
+{
+	int next = 0;
+
+	if (sel->size == 0)
+		return (0);
+
+	*value = ~sel->heap[0];
+	if (sel->more)
+		sel->more = ext_file_read(sel->in, &next);
+	if (sel->more && next >= *value)
+		sel->heap[0] = ~next;
+	else
+	{
+		sel->heap[0] = sel->heap[--sel->size];
+		if (sel->more)
+			sel->heap[--sel->dead] = ~next;
+	}
+	if (sel->size > 0)
+		array_heap_sift_down(sel->heap, sel->size, 0);
+
+	return (1);
+}
+
+/**
+ * ext_sort_runs - Splits an input file into sorted runs.
+ * A min-heap as large as the buffer is filled from the input, then runs
+ * are written to temporary files by replacement selection. The values
+ * put aside during a run make the heap of the next one. As in top_k_t,
+ * the values are stored complemented so array_heap_sift_down orders
+ * them as a min-heap.
+ *
+ * @in: A pointer to the buffered input file.
+ * @heap: A pointer to the buffer to use as a heap.
+ * @capacity: The number of values the buffer holds.
+ * @runs: A pointer to the list to add the runs to.
+ * @io: The number of values in each file buffer.
+ *
+ * Return: 1 on success, 0 on failure.
+ */
+int ext_sort_runs(ext_file_t *in, int *heap, size_t capacity,
+		  ext_runs_t *runs, size_t io)
+{
+	ext_select_t sel;
+	ext_file_t *out;
+	size_t i;
+	int value, ok = 1;
+
+	sel.in = in, sel.heap = heap, sel.size = 0, sel.more = 1;
+	while (sel.size < capacity &&
+	       (sel.more = ext_file_read(in, heap + sel.size)))
+		heap[sel.size] = ~heap[sel.size], sel.size++;
+	sel.dead = sel.end = sel.size;
+	while (ok && sel.size > 0)
+	{
+		for (i = sel.size / 2; i > 0; i--)
+			array_heap_sift_down(heap, sel.size, i - 1);
+		out = ext_file_create(ext_runs_add(runs), io);
+		if (!out)
+			return (0);
+		while (ok && ext_select_pop(&sel, &value))
+			ok = ext_file_write(out, &value, 1);
+		ok = ok && ext_file_flush(out);
+		ext_file_delete(out);
+
+		/* The values put aside make the heap of the next run */
+		sel.size = sel.end - sel.dead;
+		memmove(heap, heap + sel.dead, sizeof(*heap) * sel.size);
+		sel.dead = sel.end = sel.size;
+	}
+
+	return (ok && !in->error);
+}
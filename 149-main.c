@@ -0,0 +1,78 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * write_values - Writes random integers to a file
+ *
+ * @path: Path of the file
+ * @n: Number of values
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int write_values(const char *path, size_t n)
+{
+	FILE *fp = fopen(path, "wb");
+	size_t i;
+	int value;
+
+	if (!fp)
+		return (0);
+	srand(149);
+	for (i = 0; i < n; i++)
+	{
+		value = rand() % 1000000 - 500000;
+		fwrite(&value, sizeof(value), 1, fp);
+	}
+	return (fclose(fp) == 0);
+}
+
+/**
+ * check_values - Checks that a file holds n sorted integers
+ *
+ * @path: Path of the file
+ * @n: Expected number of values
+ *
+ * Return: 1 if the file is sorted, 0 otherwise
+ */
+int check_values(const char *path, size_t n)
+{
+	FILE *fp = fopen(path, "rb");
+	size_t count = 0;
+	int value, last = INT_MIN, sorted = 1;
+
+	if (!fp)
+		return (0);
+	while (fread(&value, sizeof(value), 1, fp) == 1)
+	{
+		if (count < 8)
+			printf("%d ", value);
+		sorted = sorted && value >= last;
+		last = value;
+		count++;
+	}
+	printf("...\n");
+	fclose(fp);
+	return (sorted && count == n);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	const char *input = "149-input.bin", *output = "149-output.bin";
+	size_t n = 1000000;
+
+	if (!write_values(input, n))
+		return (1);
+	/* 64 KiB of memory: dozens of runs and several merge passes */
+	printf("Sort: %d\n", external_sort(input, output, 65536));
+	printf("Sorted: %d\n", check_values(output, n));
+	printf("Missing input: %d\n", external_sort("149-none", output, 65536));
+	remove(input);
+	remove(output);
+	return (0);
+}
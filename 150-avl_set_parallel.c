@@ -0,0 +1,112 @@
+#include "binary_trees.h"
+
+/**
+ * avl_set_sequential - Runs a set operation on two AVL trees sequentially.
+ *
+ * @a: A pointer to the root of the first tree, may be NULL.
+ * @b: A pointer to the root of the second tree, may be NULL.
+ * @op: AVL_SET_UNION, AVL_SET_INTERSECT or AVL_SET_DIFFERENCE.
+ *
+ * Return: A pointer to the root of the result.
+ */
+avl_t *avl_set_sequential(avl_t *a, avl_t *b, int op)
+{
+	if (op == AVL_SET_UNION)
+		return (avl_union(a, b));
+	if (op == AVL_SET_INTERSECT)
+		return (avl_intersect(a, b));
+
+	return (avl_difference(a, b));
+}
+
+/**
+ * avl_set_task - Runs the set operation of a task, as a thread entry point.
+ *
+ * @arg: A pointer to the avl_set_task_t, whose result is filled in.
+ *
+ * Return: Always NULL.
+ */
+void *avl_set_task(void *arg)
+{
+	avl_set_task_t *task = arg;
+
+	task->result = avl_set_parallel(task->a, task->b, task->op,
+					task->threads);
+
+	return (NULL);
+}
+
+/**
+ * avl_set_combine - Joins the two halves of a set operation.
+ * This is the last step of avl_union, avl_intersect and avl_difference:
+ * the pivot is kept between the halves or dropped, depending on the
+ * operation and on whether the split found it in the other tree.
+ *
+ * @op: AVL_SET_UNION, AVL_SET_INTERSECT or AVL_SET_DIFFERENCE.
+ * @left: A pointer to the root of the lower half of the result.
+ * @pivot: A pointer to the detached root the inputs were split around.
+ * @duplicate: A pointer to the node the split found, NULL if none.
+ * @right: A pointer to the root of the greater half of the result.
+ *
+ * Return: A pointer to the root of the result.
+ */
+avl_t *avl_set_combine(int op, avl_t *left, avl_t *pivot, avl_t *duplicate,
+		       avl_t *right)
+{
+	binary_tree_free(duplicate);
+	if (op == AVL_SET_UNION || (op == AVL_SET_INTERSECT && duplicate))
+		return (avl_join_node(left, pivot, right));
+
+	binary_tree_free(pivot);
+
+	return (avl_join2(left, right));
+}
+
+/**
+ * avl_set_parallel - Runs a set operation on two AVL trees with threads.
+ * The inputs are split as in the sequential version, then the lower
+ * halves are handed to a new thread with half of the thread budget while
+ * the greater halves are processed on the calling thread with the rest.
+ * Below AVL_SET_GRAIN_HEIGHT, or once the budget is down to one thread,
+ * the sequential version takes over.
+ *
+ * @a: A pointer to the root of the first tree, may be NULL.
+ * @b: A pointer to the root of the second tree, may be NULL.
+ * @op: AVL_SET_UNION, AVL_SET_INTERSECT or AVL_SET_DIFFERENCE.
+ * @threads: The number of threads this call may run on.
+ *
+ * Return: A pointer to the root of the result.
+ */
+avl_t *avl_set_parallel(avl_t *a, avl_t *b, int op, size_t threads)
+{
+	avl_set_task_t lower;
+	avl_t *pivot, *duplicate, *a_right, *b_right, *right;
+	pthread_t thread;
+	int forked;
+
+	if (threads < 2 || !a || !b ||
+	    (avl_height(a) < AVL_SET_GRAIN_HEIGHT &&
+	     avl_height(b) < AVL_SET_GRAIN_HEIGHT))
+		return (avl_set_sequential(a, b, op));
+
+	lower.op = op;
+	lower.threads = threads / 2;
+	if (op == AVL_SET_DIFFERENCE)
+	{
+		pivot = avl_expose(b, &lower.b, &b_right);
+		duplicate = avl_split(a, pivot->n, &lower.a, &a_right);
+	}
+	else
+	{
+		pivot = avl_expose(a, &lower.a, &a_right);
+		duplicate = avl_split(b, pivot->n, &lower.b, &b_right);
+	}
+	forked = !pthread_create(&thread, NULL, avl_set_task, &lower);
+	if (!forked)
+		avl_set_task(&lower);
+	right = avl_set_parallel(a_right, b_right, op, threads - threads / 2);
+	if (forked)
+		pthread_join(thread, NULL);
+
+	return (avl_set_combine(op, lower.result, pivot, duplicate, right));
+}
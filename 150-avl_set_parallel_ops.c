@@ -0,0 +1,81 @@
+#include "binary_trees.h"
+
+/**
+ * avl_set_threads - Resolves the thread budget of a parallel set operation.
+ * Removed nodes are recycled by the arena they come from, and arenas are
+ * not thread-safe, so the operation runs on a single thread while an arena
+ * is active or when either tree lives in one.
+ *
+ * @a: A pointer to the root of the first tree, may be NULL.
+ * @b: A pointer to the root of the second tree, may be NULL.
+ * @threads: The number of threads requested, 0 for one per online CPU.
+ *
+ * Return: The number of threads to run on, at least 1.
+ */
+size_t avl_set_threads(const avl_t *a, const avl_t *b, size_t threads)
+{
+	tree_arena_t *arena = tree_arena_use(NULL);
+	long cpus;
+
+	tree_arena_use(arena);
+	if (arena || (a && a->in_arena) || (b && b->in_arena))
+		return (1);
+	if (threads == 0)
+	{
+		cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		threads = cpus > 0 ? (size_t)cpus : 1;
+	}
+
+	return (threads);
+}
+
+/**
+ * avl_union_parallel - Merges two AVL trees into their union with threads.
+ * It does the same as avl_union, with the halves of each split merged
+ * concurrently.
+ *
+ * @a: A pointer to the root of the first tree, may be NULL.
+ * @b: A pointer to the root of the second tree, may be NULL.
+ * @threads: The number of threads to use, 0 for one per online CPU.
+ *
+ * Return: A pointer to the root of the union.
+ */
+avl_t *avl_union_parallel(avl_t *a, avl_t *b, size_t threads)
+{
+	return (avl_set_parallel(a, b, AVL_SET_UNION,
+				 avl_set_threads(a, b, threads)));
+}
+
+/**
+ * avl_intersect_parallel - Intersects two AVL trees with threads.
+ * It does the same as avl_intersect, with the halves of each split
+ * intersected concurrently.
+ *
+ * @a: A pointer to the root of the first tree, may be NULL.
+ * @b: A pointer to the root of the second tree, may be NULL.
+ * @threads: The number of threads to use, 0 for one per online CPU.
+ *
+ * Return: A pointer to the root of the intersection.
+ */
+avl_t *avl_intersect_parallel(avl_t *a, avl_t *b, size_t threads)
+{
+	return (avl_set_parallel(a, b, AVL_SET_INTERSECT,
+				 avl_set_threads(a, b, threads)));
+}
+
+/**
+ * avl_difference_parallel - Removes the values of a tree with threads.
+ * It does the same as avl_difference, with the halves of each split
+ * reduced concurrently.
+ *
+ * @a: A pointer to the root of the tree to remove values from.
+ * @b: A pointer to the root of the tree of values to remove.
+ * @threads: The number of threads to use, 0 for one per online CPU.
+ *
+ * Return: A pointer to the root of the difference.
+ */
+avl_t *avl_difference_parallel(avl_t *a, avl_t *b, size_t threads)
+{
+	return (avl_set_parallel(a, b, AVL_SET_DIFFERENCE,
+				 avl_set_threads(a, b, threads)));
+}
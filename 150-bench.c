@@ -0,0 +1,79 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * now - Returns the wall-clock time, since clock() adds up all threads
+ *
+ * Return: The time in seconds
+ */
+double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * bench_op - Times one parallel set operation on freshly loaded trees
+ *
+ * @op: AVL_SET_UNION, AVL_SET_INTERSECT or AVL_SET_DIFFERENCE
+ * @keys: The values, n for each set
+ * @n: Number of values in each set
+ * @threads: Number of threads
+ *
+ * Return: The time in seconds
+ */
+double bench_op(int op, int *keys, size_t n, size_t threads)
+{
+	avl_t *a = array_to_avl_bulk(keys, n);
+	avl_t *b = array_to_avl_bulk(keys + n, n);
+	double start = now(), seconds;
+
+	a = avl_set_parallel(a, b, op, threads);
+	seconds = now() - start;
+	binary_tree_delete(a);
+	return (seconds);
+}
+
+/**
+ * main - Benchmarks the parallel AVL set operations from 1 thread up
+ * to the number given as argument (default 64), doubling at each step
+ *
+ * @argc: Number of arguments
+ * @argv: Arguments, argv[1] being the number of keys in each set
+ * (default 100M) and argv[2] the largest number of threads
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int argc, char **argv)
+{
+	size_t i, n = argc > 1 ? strtoul(argv[1], NULL, 10) : 100000000;
+	size_t max = argc > 2 ? strtoul(argv[2], NULL, 10) : 64;
+	double base[3], t[3];
+	int *keys;
+
+	keys = malloc(sizeof(*keys) * n * 2);
+	if (!keys)
+		return (1);
+	srand(98);
+	for (i = 0; i < n * 2; i++)
+		keys[i] = rand() % (n * 2);
+	printf("%lu keys per set\n", (unsigned long)n);
+	for (i = 1; i <= max; i *= 2)
+	{
+		t[0] = bench_op(AVL_SET_UNION, keys, n, i);
+		t[1] = bench_op(AVL_SET_INTERSECT, keys, n, i);
+		t[2] = bench_op(AVL_SET_DIFFERENCE, keys, n, i);
+		if (i == 1)
+			base[0] = t[0], base[1] = t[1], base[2] = t[2];
+		printf("  %2lu threads: union %.3fs (x%.2f)", (unsigned long)i,
+		       t[0], base[0] / t[0]);
+		printf("  intersect %.3fs (x%.2f)", t[1], base[1] / t[1]);
+		printf("  difference %.3fs (x%.2f)\n", t[2], base[2] / t[2]);
+	}
+	free(keys);
+	return (0);
+}
@@ -0,0 +1,100 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * binary_tree_to_array - Stores the values of a tree in order
+ *
+ * @tree: Pointer to the root of the tree
+ * @values: Array to store the values in
+ * @i: Pointer to the index of the next value to store
+ */
+void binary_tree_to_array(const avl_t *tree, int *values, size_t *i)
+{
+	if (!tree)
+		return;
+	binary_tree_to_array(tree->left, values, i);
+	values[(*i)++] = tree->n;
+	binary_tree_to_array(tree->right, values, i);
+}
+
+/**
+ * same_values - Checks that two trees hold the same values
+ *
+ * @a: Pointer to the root of the first tree
+ * @b: Pointer to the root of the second tree
+ *
+ * Return: 1 if they do, 0 otherwise
+ */
+int same_values(const avl_t *a, const avl_t *b)
+{
+	int *values;
+	size_t size = binary_tree_size(a), i;
+	int same;
+
+	if (size != binary_tree_size(b))
+		return (0);
+	if (size == 0)
+		return (1);
+	values = malloc(sizeof(*values) * size * 2);
+	if (!values)
+		return (0);
+	i = 0;
+	binary_tree_to_array(a, values, &i);
+	binary_tree_to_array(b, values, &i);
+	same = !memcmp(values, values + size, sizeof(*values) * size);
+	free(values);
+	return (same);
+}
+
+/**
+ * run - Runs a set operation in parallel and sequentially and compares
+ *
+ * @name: Name of the operation
+ * @op: AVL_SET_UNION, AVL_SET_INTERSECT or AVL_SET_DIFFERENCE
+ * @a: Values of the first set
+ * @b: Values of the second set
+ * @n: Number of values in each set
+ */
+void run(const char *name, int op, int *a, int *b, size_t n)
+{
+	avl_t *parallel, *sequential;
+
+	parallel = avl_set_parallel(array_to_avl_bulk(a, n),
+				    array_to_avl_bulk(b, n), op, 4);
+	sequential = avl_set_sequential(array_to_avl_bulk(a, n),
+					array_to_avl_bulk(b, n), op);
+	printf("%s: %lu values, is AVL %d, same as sequential %d\n", name,
+	       (unsigned long)binary_tree_size(parallel),
+	       binary_tree_is_avl(parallel), same_values(parallel, sequential));
+	binary_tree_delete(parallel);
+	binary_tree_delete(sequential);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+	size_t i, n = 300000;
+	int *a, *b;
+
+	a = malloc(sizeof(*a) * n);
+	b = malloc(sizeof(*b) * n);
+	if (!a || !b)
+		return (1);
+	srand(150);
+	for (i = 0; i < n; i++)
+	{
+		a[i] = rand() % 1000000;
+		b[i] = rand() % 1000000;
+	}
+	run("Union", AVL_SET_UNION, a, b, n);
+	run("Intersection", AVL_SET_INTERSECT, a, b, n);
+	run("Difference", AVL_SET_DIFFERENCE, a, b, n);
+	free(a);
+	free(b);
+	return (0);
+}
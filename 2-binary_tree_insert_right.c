@@ -24,17 +24,11 @@ binary_tree_t *binary_tree_insert_right(binary_tree_t *parent, int value)
 	if (parent == NULL)
 		return (NULL);
 
-	/* Allocate memory for the right child */
-	right_child = malloc(sizeof(binary_tree_t));
+	/* Create and initialize the right child */
+	right_child = binary_tree_node(parent, value);
 	if (right_child == NULL)
 		return (NULL);
 
-	/* Assign values to the right child */
-	right_child->n = value;
-	right_child->left = NULL;
-	right_child->right = NULL;
-	right_child->parent = parent;
-
 	/* If the parent already has a right child */
 	if (parent->right != NULL)
 	{
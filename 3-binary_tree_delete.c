@@ -20,6 +20,6 @@ void binary_tree_delete(binary_tree_t *tree)
 		binary_tree_delete(tree->right);
 
 		/* Free the memory allocated for the current node */
-		free(tree);
+		binary_tree_free(tree);
 	}
 }
@@ -9,6 +9,8 @@
 #include <stddef.h>
 #include <limits.h>
 #include <math.h>
+#include <stdint.h>
+#include <pthread.h>
 
 /* Structs */
 /* Main Structs */
@@ -17,6 +19,10 @@
  * struct binary_tree_s - Binary tree node
  *
  * @n: Integer stored in the node
+ * @height: Height of the subtree rooted at the node, 1 for a leaf. It sits
+ * in the padding after @n and is kept up to date by the rotations and the
+ * AVL functions
+ * @in_arena: Set if the node was carved from a tree arena slab
  * @parent: Pointer to the parent node
  * @left: Pointer to the left child node
  * @right: Pointer to the right child node
@@ -24,6 +30,8 @@
 struct binary_tree_s
 {
 	int n;
+	signed int height : 31;
+	unsigned int in_arena : 1;
 	struct binary_tree_s *parent;
 	struct binary_tree_s *left;
 	struct binary_tree_s *right;
@@ -40,6 +48,435 @@ typedef struct binary_tree_s avl_t;
 /* Max Binary Heap */
 typedef struct binary_tree_s heap_t;
 
+/* Pairing Heap node: @left is the first child, @right the next sibling */
+typedef struct binary_tree_s pairing_node_t;
+
+/**
+ * struct tree_slab_s - Block of contiguous binary tree nodes
+ *
+ * @arena: Pointer to the arena owning the slab
+ * @next: Pointer to the previously allocated slab
+ * @used: Number of nodes already handed out from this slab
+ * @capacity: Number of nodes the slab can hold
+ *
+ * Description: The nodes are stored right after this header, and the slab
+ * is aligned on TREE_ARENA_SLAB_BYTES so that the header of the slab
+ * holding a node is found by masking the address of the node.
+ */
+typedef struct tree_slab_s
+{
+	struct tree_arena_s *arena;
+	struct tree_slab_s *next;
+	size_t used;
+	size_t capacity;
+} tree_slab_t;
+
+/**
+ * struct tree_arena_s - Slab allocator for binary tree nodes
+ *
+ * @slabs: Pointer to the most recently allocated slab
+ * @free_list: Nodes of the arena released for reuse, linked by @left
+ * @slab_size: Number of nodes per slab
+ */
+typedef struct tree_arena_s
+{
+	tree_slab_t *slabs;
+	binary_tree_t *free_list;
+	size_t slab_size;
+} tree_arena_t;
+
+/* Size and alignment of an arena slab in bytes, a power of two */
+#define TREE_ARENA_SLAB_BYTES 65536
+/* Default and largest number of nodes per arena slab */
+#define TREE_ARENA_SLAB_SIZE \
+	((TREE_ARENA_SLAB_BYTES - sizeof(tree_slab_t)) / sizeof(binary_tree_t))
+
+/**
+ * struct compact_node_s - Binary tree node linked by 32-bit indices
+ *
+ * @n: Integer stored in the node
+ * @parent: Index of the parent node
+ * @balance: Height of the left subtree minus the height of the right one,
+ * only maintained by compact_avl_insert
+ * @left: Index of the left child node
+ * @right: Index of the right child node
+ */
+typedef struct compact_node_s
+{
+	int n;
+	uint32_t parent : 30;
+	signed int balance : 2;
+	uint32_t left;
+	uint32_t right;
+} compact_node_t;
+
+/**
+ * struct compact_tree_s - Binary tree stored in a single node array
+ *
+ * @nodes: Array holding every node of the tree
+ * @root: Index of the root node
+ * @size: Number of nodes in use
+ * @capacity: Number of nodes the array can hold
+ */
+typedef struct compact_tree_s
+{
+	compact_node_t *nodes;
+	uint32_t root;
+	uint32_t size;
+	uint32_t capacity;
+} compact_tree_t;
+
+/* Index standing for a missing node, parent indices only have 30 bits */
+#define COMPACT_NIL ((uint32_t)0x3FFFFFFF)
+
+/**
+ * struct frozen_index_s - Read-only BST search index in Eytzinger order
+ *
+ * @keys: Values laid out breadth-first, 1-based (slot 0 is unused),
+ * aligned on a 64-byte cache line
+ * @size: Number of values
+ */
+typedef struct frozen_index_s
+{
+	int *keys;
+	size_t size;
+} frozen_index_t;
+
+/* Slots per 64-byte line of the aligned keys, prefetched 4 levels ahead */
+#define FROZEN_PREFETCH_STRIDE 16
+
+/**
+ * struct stree_s - Static B-tree search index with one cache line per node
+ *
+ * @keys: STREE_B keys per node, nodes stored breadth-first, 64-byte aligned
+ * @blocks: Number of nodes
+ * @size: Number of values
+ * @max: Largest value, anything above it is padding
+ */
+typedef struct stree_s
+{
+	int *keys;
+	size_t blocks;
+	size_t size;
+	int max;
+} stree_t;
+
+/* Number of keys per static search tree node */
+#define STREE_B 16
+
+/* Number of searches kept in flight by bst_search_batch */
+#define BST_BATCH_WIDTH 16
+
+/**
+ * struct array_heap_s - Max binary heap stored in a level-order array
+ *
+ * @array: Values in level order, children of i at 2i + 1 and 2i + 2
+ * @size: Number of values in the heap
+ * @capacity: Number of values the array can hold
+ */
+typedef struct array_heap_s
+{
+	int *array;
+	size_t size;
+	size_t capacity;
+} array_heap_t;
+
+/**
+ * struct heap_handle_s - Pointer max-heap with a cached node count
+ *
+ * @root: Pointer to the root node of the heap
+ * @size: Number of nodes in the heap
+ */
+typedef struct heap_handle_s
+{
+	heap_t *root;
+	size_t size;
+} heap_handle_t;
+
+/* Number of children per node of a d-ary heap, 4 or 8 */
+#ifndef DARY_HEAP_D
+#define DARY_HEAP_D 4
+#endif
+
+/**
+ * struct dary_heap_s - Max d-ary heap stored in a level-order array
+ *
+ * @base: 64-byte aligned block holding the values
+ * @array: Values in level order, children of i at d * i + 1 to d * i + d
+ * @size: Number of values in the heap
+ * @capacity: Number of values the array can hold
+ */
+typedef struct dary_heap_s
+{
+	void *base;
+	int *array;
+	size_t size;
+	size_t capacity;
+} dary_heap_t;
+
+/**
+ * struct indexed_heap_s - Max heap of entries with stable handles
+ *
+ * @priority: Priority of each entry, indexed by handle
+ * @heap: Handles in heap order, followed by the handles free for reuse
+ * @pos: Position of each handle in @heap
+ * @size: Number of entries in the heap
+ * @count: Number of handles handed out so far
+ * @capacity: Number of handles the arrays can hold
+ */
+typedef struct indexed_heap_s
+{
+	int *priority;
+	size_t *heap;
+	size_t *pos;
+	size_t size;
+	size_t count;
+	size_t capacity;
+} indexed_heap_t;
+
+/* Handle returned when an indexed heap insertion fails */
+#define INDEXED_HEAP_NONE ((size_t)-1)
+
+/**
+ * struct pairing_heap_s - Max pairing heap
+ *
+ * @root: Pointer to the root node, holding the maximum
+ * @size: Number of values in the heap
+ */
+typedef struct pairing_heap_s
+{
+	pairing_node_t *root;
+	size_t size;
+} pairing_heap_t;
+
+/**
+ * struct top_k_s - Bounded min-heap keeping the k greatest values seen
+ *
+ * @array: Kept values in level order, complemented (~value) so that
+ * the smallest is at index 0 of a max-heap
+ * @size: Number of values kept
+ * @k: Maximum number of values kept
+ */
+typedef struct top_k_s
+{
+	int *array;
+	size_t size;
+	size_t k;
+} top_k_t;
+
+/**
+ * struct radix_bucket_s - Bucket of keys of a radix heap
+ *
+ * @keys: Keys of the bucket, in no particular order
+ * @size: Number of keys in the bucket
+ * @capacity: Number of keys the array can hold
+ */
+typedef struct radix_bucket_s
+{
+	unsigned int *keys;
+	size_t size;
+	size_t capacity;
+} radix_bucket_t;
+
+/* One bucket for the last extracted key, one per bit of difference */
+#define RADIX_HEAP_BUCKETS (sizeof(unsigned int) * CHAR_BIT + 1)
+
+/* Order-preserving mapping between int values and unsigned keys */
+#define RADIX_HEAP_SIGN ((unsigned int)INT_MAX + 1)
+#define RADIX_HEAP_KEY(value) ((unsigned int)(value) ^ RADIX_HEAP_SIGN)
+#define RADIX_HEAP_VALUE(key) ((int)((key) ^ RADIX_HEAP_SIGN))
+
+/**
+ * struct radix_heap_s - Monotone min-priority queue over int keys
+ *
+ * @buckets: Keys filed by the highest bit where they differ from @last
+ * @last: Last extracted key, all keys in the heap are not lower
+ * @size: Number of keys in the heap
+ */
+typedef struct radix_heap_s
+{
+	radix_bucket_t buckets[RADIX_HEAP_BUCKETS];
+	unsigned int last;
+	size_t size;
+} radix_heap_t;
+
+/**
+ * struct minmax_heap_s - Double-ended priority queue (min-max heap)
+ *
+ * @array: Values in level order, even levels min-ordered, odd levels
+ * max-ordered
+ * @size: Number of values in the heap
+ * @capacity: Number of values the array can hold
+ */
+typedef struct minmax_heap_s
+{
+	int *array;
+	size_t size;
+	size_t capacity;
+} minmax_heap_t;
+
+/* Arrays smaller than this are heapified or sorted on the calling thread */
+#define HEAP_PARALLEL_GRAIN 65536
+/* Cap on the threads of one parallel heap operation, its tasks live on stack */
+#define HEAP_PARALLEL_MAX_THREADS 256
+
+/**
+ * struct heap_task_s - Share of a parallel heap operation
+ *
+ * @array: Array the threads work on
+ * @size: Number of values in the whole array
+ * @first: Index of the first slot of the share
+ * @count: Number of slots in the share
+ * @runs: Shares of the sorted runs a merge part reads, NULL otherwise
+ * @run_count: Number of @runs
+ */
+typedef struct heap_task_s
+{
+	int *array;
+	size_t size;
+	size_t first;
+	size_t count;
+	struct heap_task_s *runs;
+	size_t run_count;
+} heap_task_t;
+
+/**
+ * merge_read_t - Reads the next value of a sorted source
+ * It returns 1 and stores the value in its second argument, or returns 0
+ * once the source is exhausted.
+ */
+typedef int (*merge_read_t)(void *, int *);
+
+/**
+ * merge_write_t - Receives a chunk of merged values
+ * It returns 1 on success, or 0 to abort the merge.
+ */
+typedef int (*merge_write_t)(void *, const int *, size_t);
+
+/* Values merged into a stack buffer before each call of the write sink */
+#define LOSER_TREE_CHUNK 4096
+
+/**
+ * struct loser_tree_s - Tournament tree merging k sorted sources
+ *
+ * @k: Number of sources
+ * @nodes: Index of the winner at 0, then the loser of each match
+ * @sources: Sources passed to @read
+ * @keys: Current value of each source
+ * @done: Whether each source is exhausted
+ * @read: Function reading the next value of a source
+ */
+typedef struct loser_tree_s
+{
+	size_t k;
+	size_t *nodes;
+	void **sources;
+	int *keys;
+	char *done;
+	merge_read_t read;
+} loser_tree_t;
+
+/**
+ * struct merge_run_s - In-memory sorted run, source of a loser tree
+ *
+ * @array: Sorted values
+ * @size: Number of values
+ * @pos: Index of the next value to read
+ */
+typedef struct merge_run_s
+{
+	const int *array;
+	size_t size;
+	size_t pos;
+} merge_run_t;
+
+/* Smallest I/O block, in ints, so each read or write moves enough data */
+#define EXT_SORT_IO_MIN 1024
+/* Largest I/O block, in ints, past which more budget goes to longer runs */
+#define EXT_SORT_IO_MAX 262144
+
+/**
+ * struct ext_file_s - File of integers accessed through a large buffer
+ *
+ * @fp: Underlying file
+ * @buffer: Values read ahead or waiting to be written
+ * @size: Number of values in the buffer
+ * @pos: Index of the next value to read from the buffer
+ * @capacity: Number of values the buffer holds
+ * @error: Whether a read or a write failed
+ */
+typedef struct ext_file_s
+{
+	FILE *fp;
+	int *buffer;
+	size_t size;
+	size_t pos;
+	size_t capacity;
+	int error;
+} ext_file_t;
+
+/**
+ * struct ext_runs_s - Queue of sorted runs spilled to temporary files
+ *
+ * @files: Temporary files, one per run
+ * @head: Index of the oldest run not merged yet
+ * @count: Number of runs made so far
+ * @capacity: Number of runs the array can hold
+ */
+typedef struct ext_runs_s
+{
+	FILE **files;
+	size_t head;
+	size_t count;
+	size_t capacity;
+} ext_runs_t;
+
+/**
+ * struct ext_select_s - State of a replacement selection
+ *
+ * @in: Input file
+ * @heap: Buffer, a min-heap for the current run first, then a gap, then
+ * the values put aside for the next run, all stored complemented (~value)
+ * @size: Number of values in the heap
+ * @dead: Index of the first value put aside
+ * @end: Number of slots in use in the buffer
+ * @more: Whether the input has more values
+ */
+typedef struct ext_select_s
+{
+	ext_file_t *in;
+	int *heap;
+	size_t size;
+	size_t dead;
+	size_t end;
+	int more;
+} ext_select_t;
+
+/* Set operations run by avl_set_task */
+#define AVL_SET_UNION 0
+#define AVL_SET_INTERSECT 1
+#define AVL_SET_DIFFERENCE 2
+/* Trees lower than this are combined without spawning a thread */
+#define AVL_SET_GRAIN_HEIGHT 16
+
+/**
+ * struct avl_set_task_s - Half of a parallel AVL set operation
+ *
+ * @a: Root of the first tree
+ * @b: Root of the second tree
+ * @result: Root of the result, filled in by avl_set_task
+ * @threads: Number of threads the task may run on
+ * @op: AVL_SET_UNION, AVL_SET_INTERSECT or AVL_SET_DIFFERENCE
+ */
+typedef struct avl_set_task_s
+{
+	avl_t *a;
+	avl_t *b;
+	avl_t *result;
+	size_t threads;
+	int op;
+} avl_set_task_t;
+
 
 /* functions */
 /* Main functions */
@@ -49,6 +486,10 @@ void binary_tree_print(const binary_tree_t *tree);
 /*===========================================================================*/
 
 /* Task 0. New node */
+tree_arena_t *tree_arena_use(tree_arena_t *arena);
+binary_tree_t *tree_arena_carve(tree_arena_t *arena);
+binary_tree_t *tree_arena_alloc(tree_arena_t *arena);
+void binary_tree_free(binary_tree_t *node);
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value);
 /*===========================================================================*/
 
@@ -199,20 +640,17 @@ int binary_tree_is_avl(const binary_tree_t *tree);
 /*===========================================================================*/
 
 /* Task (121) 31. AVL - Insert */
-avl_t *insert_avl_node(avl_t **root, avl_t *parent,
-												avl_t **new_node, int value);
+/* avl_t *avl_cached_insert(avl_t **tree, int value); */
 avl_t *avl_insert(avl_t **tree, int value);
 /*===========================================================================*/
 
 /* Task (122) 32. AVL - Array to AVL */
+/* avl_t *array_to_avl_cached(int *array, size_t size); */
 avl_t *array_to_avl(int *array, size_t size);
 /*===========================================================================*/
 
 /* Task (123) 33. AVL - Remove */
-void balance_avl_tree(avl_t **root);
-/* int find_inorder_successor(bst_t *node); */
-/* int remove_node(bst_t *root); */
-/* bst_t *bst_remove(bst_t *root, int value); */
+/* avl_t *avl_cached_remove(avl_t *root, int value); */
 avl_t *avl_remove(avl_t *root, int value);
 /*===========================================================================*/
 
@@ -257,6 +695,314 @@ int *heap_to_sorted_array(heap_t *heap, size_t *size);
 /* Task (135) 41. Big O #Binary Heap */
 /*===========================================================================*/
 
+/* Task (105) 42. Tree arena */
+/* tree_arena_t *tree_arena_use(tree_arena_t *arena); */
+tree_arena_t *tree_arena_create(size_t slab_size);
+void tree_arena_release(tree_arena_t *arena);
+/*===========================================================================*/
+
+/* Task (106) 43. Compact index-based trees */
+compact_tree_t *compact_tree_create(size_t capacity);
+void compact_tree_delete(compact_tree_t *tree);
+uint32_t compact_tree_node(compact_tree_t *tree, uint32_t parent, int value);
+size_t compact_tree_height(const compact_tree_t *tree, uint32_t node);
+uint32_t compact_bst_search(const compact_tree_t *tree, int value);
+uint32_t compact_bst_insert(compact_tree_t *tree, int value);
+void compact_replace_child(compact_tree_t *tree, uint32_t parent,
+			   uint32_t old, uint32_t new);
+uint32_t compact_rotate_left(compact_tree_t *tree, uint32_t node);
+uint32_t compact_rotate_right(compact_tree_t *tree, uint32_t node);
+void compact_avl_rebalance(compact_tree_t *tree, uint32_t node, int value);
+uint32_t compact_avl_insert(compact_tree_t *tree, int value);
+uint32_t compact_heap_insert(compact_tree_t *tree, int value);
+int compact_heap_extract(compact_tree_t *tree);
+/*===========================================================================*/
+
+/* Task (107) 44. Cache-oblivious relayout */
+/* binary_tree_t *tree_arena_carve(tree_arena_t *arena); */
+size_t relayout_measure(const binary_tree_t *tree, size_t *size);
+binary_tree_t *relayout_place(const binary_tree_t *tree, size_t height,
+			      binary_tree_t *parent, tree_arena_t *arena,
+			      size_t *pos);
+void relayout_bottoms(const binary_tree_t *tree, binary_tree_t *copy,
+		      size_t depth, size_t height, tree_arena_t *arena,
+		      size_t *pos);
+binary_tree_t *binary_tree_relayout(const binary_tree_t *tree,
+				    tree_arena_t *arena);
+/*===========================================================================*/
+
+/* Task (116) 45. BST - Frozen search index */
+/* size_t binary_tree_size(const binary_tree_t *tree); */
+void freeze_inorder(const bst_t *tree, int *array, size_t *pos);
+void freeze_eytzinger(const int *sorted, size_t *pos, int *keys,
+		      size_t k, size_t size);
+frozen_index_t *bst_freeze(const bst_t *tree);
+void frozen_index_delete(frozen_index_t *index);
+const int *frozen_search(const frozen_index_t *index, int value);
+/*===========================================================================*/
+
+/* Task (117) 46. BST - Static SIMD search tree */
+/* size_t binary_tree_size(const binary_tree_t *tree); */
+/* void freeze_inorder(const bst_t *tree, int *array, size_t *pos); */
+void stree_build(stree_t *tree, const int *sorted, size_t *pos, size_t k);
+stree_t *sorted_array_to_stree(const int *array, size_t size);
+stree_t *bst_to_stree(const bst_t *tree);
+void stree_delete(stree_t *tree);
+unsigned int stree_node_rank(const int *keys, int value);
+const int *stree_search(const stree_t *tree, int value);
+/*===========================================================================*/
+
+/* Task (118) 47. BST - Batched search */
+int bst_batch_step(const bst_t **cursor, int value);
+size_t bst_search_batch(const bst_t *tree, const int *keys, size_t n,
+			bst_t **out);
+/*===========================================================================*/
+
+/* Task (136) 48. Heap - Array-backed heap */
+/* size_t binary_tree_size(const binary_tree_t *tree); */
+array_heap_t *array_heap_create(size_t capacity);
+void array_heap_delete(array_heap_t *heap);
+int array_heap_push(array_heap_t *heap, int value);
+int array_heap_peek(const array_heap_t *heap);
+void array_heap_sift_down(int *array, size_t size, size_t i);
+int array_heap_pop(array_heap_t *heap);
+void array_heap_fill(const heap_t *node, int *array, size_t i);
+array_heap_t *heap_to_array_heap(const heap_t *tree);
+heap_t *array_heap_build_tree(heap_t *parent, const int *array,
+			      size_t size, size_t i);
+heap_t *array_heap_to_heap(const array_heap_t *heap);
+/*===========================================================================*/
+
+/* Task (137) 49. Heap - Bottom-up heap construction */
+/* void array_heap_sift_down(int *array, size_t size, size_t i); */
+/* heap_t *array_heap_build_tree(heap_t *parent, const int *array, */
+/* size_t size, size_t i); */
+void array_heapify(int *array, size_t size);
+array_heap_t *array_to_array_heap(const int *array, size_t size);
+heap_t *array_to_heap_bottom_up(int *array, size_t size);
+/*===========================================================================*/
+
+/* Task (138) 50. Heap - Size-tracking handle */
+/* size_t binary_tree_size(const binary_tree_t *tree); */
+/* void trickle_down(heap_t *current_parent); */
+void heap_handle_init(heap_handle_t *handle, heap_t *root);
+heap_t *heap_handle_node(heap_t *root, size_t position);
+heap_t *heap_handle_insert(heap_handle_t *handle, int value);
+int heap_handle_extract(heap_handle_t *handle);
+/*===========================================================================*/
+
+/* Task (139) 51. Heap - In-place heap sort */
+/* void array_heap_sift_down(int *array, size_t size, size_t i); */
+/* void array_heapify(int *array, size_t size); */
+void heap_sort_drain(int *array, size_t size);
+void heap_sort_reverse(int *array, size_t size);
+void heap_sort_array(int *array, size_t size, int descending);
+array_heap_t *array_heap_wrap(int *array, size_t size, size_t capacity);
+int *array_heap_to_sorted_array(array_heap_t *heap, size_t *size);
+/*===========================================================================*/
+
+/* Task (140) 52. Heap - d-ary heap */
+int dary_heap_alloc(dary_heap_t *heap, size_t capacity);
+dary_heap_t *dary_heap_create(size_t capacity);
+void dary_heap_delete(dary_heap_t *heap);
+int dary_heap_insert(dary_heap_t *heap, int value);
+void dary_heap_sift_down(int *array, size_t size, size_t i);
+int dary_heap_extract(dary_heap_t *heap);
+/*===========================================================================*/
+
+/* Task (141) 53. Heap - Indexed priority queue */
+int indexed_heap_grow(indexed_heap_t *heap, size_t capacity);
+indexed_heap_t *indexed_heap_create(size_t capacity);
+void indexed_heap_delete(indexed_heap_t *heap);
+size_t indexed_heap_insert(indexed_heap_t *heap, int priority);
+void indexed_heap_sift_up(indexed_heap_t *heap, size_t i);
+void indexed_heap_sift_down(indexed_heap_t *heap, size_t i);
+int indexed_heap_contains(const indexed_heap_t *heap, size_t handle);
+int indexed_heap_update(indexed_heap_t *heap, size_t handle, int priority);
+int indexed_heap_remove(indexed_heap_t *heap, size_t handle);
+int indexed_heap_extract(indexed_heap_t *heap, size_t *handle);
+/*===========================================================================*/
+
+/* Task (142) 54. Heap - Pairing heap */
+/* size_t binary_tree_size(const binary_tree_t *tree); */
+pairing_node_t *pairing_link(pairing_node_t *first, pairing_node_t *second);
+pairing_node_t *pairing_heap_insert(pairing_heap_t *heap, int value);
+void pairing_heap_meld(pairing_heap_t *heap, pairing_heap_t *other);
+pairing_node_t *pairing_merge_pairs(pairing_node_t *first);
+int pairing_heap_extract(pairing_heap_t *heap);
+void pairing_from_heap(heap_t *node);
+void heap_to_pairing_heap(pairing_heap_t *heap, heap_t *tree);
+void pairing_heap_delete(pairing_heap_t *heap);
+/*===========================================================================*/
+
+/* Task (143) 55. Heap - Top-k extraction */
+/* void trickle_down(heap_t *current_parent); */
+/* void heap_handle_init(heap_handle_t *handle, heap_t *root); */
+/* heap_t *heap_handle_node(heap_t *root, size_t position); */
+void heap_frontier_push(const heap_t **frontier, size_t *size,
+			const heap_t *node);
+const heap_t *heap_frontier_pop(const heap_t **frontier, size_t *size);
+size_t heap_count_upto(const heap_t *root, size_t limit);
+size_t heap_frontier_walk(const heap_t *root, size_t k, int *out,
+			  const heap_t **frontier, const heap_t **nodes);
+size_t heap_peek_k(const heap_t *root, size_t k, int *out);
+size_t heap_node_position(const heap_t *node);
+void heap_extract_refill(heap_handle_t *handle, const heap_t **found,
+			 size_t k, unsigned char *last);
+size_t heap_handle_extract_k(heap_handle_t *handle, size_t k, int *out);
+size_t heap_extract_k(heap_t **root, size_t k, int *out);
+/*===========================================================================*/
+
+/* Task (144) 56. Heap - Streaming top-k selection */
+/* void array_heap_sift_down(int *array, size_t size, size_t i); */
+top_k_t *top_k_create(size_t k);
+void top_k_delete(top_k_t *top);
+int top_k_push(top_k_t *top, int value);
+size_t top_k_push_batch(top_k_t *top, const int *values, size_t n);
+int *top_k_sorted(const top_k_t *top, size_t *size);
+/*===========================================================================*/
+
+/* Task (145) 57. Heap - Radix heap */
+radix_heap_t *radix_heap_create(void);
+void radix_heap_delete(radix_heap_t *heap);
+size_t radix_heap_bucket(unsigned int key, unsigned int last);
+int radix_bucket_push(radix_bucket_t *bucket, unsigned int key);
+int radix_heap_insert(radix_heap_t *heap, int value);
+int radix_bucket_reserve(radix_bucket_t *bucket, size_t needed);
+int radix_heap_refill(radix_heap_t *heap);
+int radix_heap_extract(radix_heap_t *heap);
+/*===========================================================================*/
+
+/* Task (146) 58. Heap - Min-max heap */
+minmax_heap_t *minmax_heap_create(size_t capacity);
+void minmax_heap_delete(minmax_heap_t *heap);
+int minmax_is_max_level(size_t i);
+void minmax_bubble_up(int *array, size_t i);
+int minmax_heap_insert(minmax_heap_t *heap, int value);
+size_t minmax_best_descendant(const int *array, size_t size, size_t i,
+			      int max);
+void minmax_trickle_down(int *array, size_t size, size_t i);
+int minmax_heap_remove_at(minmax_heap_t *heap, size_t i);
+int minmax_heap_extract_min(minmax_heap_t *heap);
+int minmax_heap_extract_max(minmax_heap_t *heap);
+size_t minmax_heap_max_index(const minmax_heap_t *heap);
+int minmax_heap_peek_min(const minmax_heap_t *heap);
+int minmax_heap_peek_max(const minmax_heap_t *heap);
+minmax_heap_t *array_to_minmax_heap(const int *array, size_t size);
+/*===========================================================================*/
+
+/* Task (147) 59. Heap - Parallel heapify and heap sort */
+/* void array_heap_sift_down(int *array, size_t size, size_t i); */
+/* void array_heapify(int *array, size_t size); */
+/* heap_t *array_heap_build_tree(heap_t *parent, const int *array, */
+/* size_t size, size_t i); */
+/* void heap_sort_array(int *array, size_t size, int descending); */
+size_t heap_parallel_threads(size_t threads);
+void heap_parallel_run(heap_task_t *tasks, size_t count,
+		       void *(*worker)(void *));
+void *heap_heapify_subtrees(void *arg);
+void array_heapify_parallel(int *array, size_t size, size_t threads);
+heap_t *array_to_heap_parallel(int *array, size_t size, size_t threads);
+void *heap_sort_chunk(void *arg);
+void heap_merge_sift_down(const int *array, size_t *heap, const size_t *next,
+			  size_t size, size_t i);
+int heap_merge_runs(const int *array, const heap_task_t *tasks, size_t runs,
+		    int *out);
+size_t heap_merge_lower_bound(const int *array, size_t first, size_t end,
+			      int value);
+void heap_merge_splitters(const int *array, const heap_task_t *runs,
+			  size_t count, size_t parts, int *splitters);
+void heap_merge_split(int *array, const heap_task_t *runs, size_t count,
+		      const int *splitters, heap_task_t *parts,
+		      size_t part_count);
+void *heap_merge_part(void *arg);
+int heap_merge_parallel(int *array, const heap_task_t *runs, size_t count,
+			int *out, size_t threads);
+int heap_sort_parallel(int *array, size_t size, size_t threads);
+/*===========================================================================*/
+
+/* Task (148) 60. Heap - Loser tree k-way merge */
+loser_tree_t *loser_tree_create(size_t k, merge_read_t read, void **sources);
+void loser_tree_delete(loser_tree_t *tree);
+int loser_tree_less(const loser_tree_t *tree, size_t a, size_t b);
+void loser_tree_build(loser_tree_t *tree);
+void loser_tree_replay(loser_tree_t *tree);
+int loser_tree_pop(loser_tree_t *tree, int *value);
+size_t loser_tree_merge(loser_tree_t *tree, merge_write_t write, void *sink);
+int merge_run_read(void *source, int *value);
+int merge_array_write(void *sink, const int *values, size_t count);
+size_t merge_sorted_arrays(const int **arrays, const size_t *sizes, size_t k,
+			   int *out);
+/*===========================================================================*/
+
+/* Task (149) 61. Heap - External sort */
+/* void array_heap_sift_down(int *array, size_t size, size_t i); */
+ext_file_t *ext_file_create(FILE *fp, size_t capacity);
+void ext_file_delete(ext_file_t *file);
+int ext_file_read(void *source, int *value);
+int ext_file_write(void *sink, const int *values, size_t count);
+int ext_file_flush(ext_file_t *file);
+FILE *ext_runs_add(ext_runs_t *runs);
+void ext_runs_close(ext_runs_t *runs);
+int ext_select_pop(ext_select_t *sel, int *value);
+int ext_sort_runs(ext_file_t *in, int *heap, size_t capacity,
+		  ext_runs_t *runs, size_t io);
+int ext_sort_merge(ext_runs_t *runs, size_t count, FILE *fp, size_t io);
+int external_sort(const char *input, const char *output, size_t memory);
+/*===========================================================================*/
+
+/* Task (126) 62. AVL - Stored heights */
+/* avl_t *binary_tree_rotate_left(avl_t *tree); */
+/* avl_t *binary_tree_rotate_right(avl_t *tree); */
+/* bst_t *bst_search(const bst_t *tree, int value); */
+int avl_height(const avl_t *tree);
+void avl_update_height(avl_t *node);
+avl_t *avl_cached_rebalance(avl_t *node);
+void avl_cached_retrace(avl_t **tree, avl_t *node);
+avl_t *avl_cached_insert(avl_t **tree, int value);
+avl_t *array_to_avl_cached(int *array, size_t size);
+/*===========================================================================*/
+
+/* Task (127) 63. AVL - Path-local remove */
+/* void avl_cached_retrace(avl_t **tree, avl_t *node); */
+avl_t *avl_cached_unlink(avl_t **tree, avl_t *node);
+avl_t *avl_cached_remove(avl_t *root, int value);
+/*===========================================================================*/
+
+/* Task (128) 64. AVL - Bulk load from an unsorted array */
+/* avl_t *create_balanced_avl(avl_t *parent, int *array, int start, int end); */
+void radix_sort_int(int *array, size_t size, int *scratch);
+size_t sorted_array_unique(int *array, size_t size);
+avl_t *array_to_avl_bulk(int *array, size_t size);
+/*===========================================================================*/
+
+/* Task (129) 65. AVL - Split, join and set operations */
+/* void avl_cached_retrace(avl_t **tree, avl_t *node); */
+avl_t *avl_expose(avl_t *node, avl_t **left, avl_t **right);
+avl_t *avl_join_right(avl_t *left, avl_t *node, avl_t *right);
+avl_t *avl_join_left(avl_t *left, avl_t *node, avl_t *right);
+avl_t *avl_join_node(avl_t *left, avl_t *node, avl_t *right);
+avl_t *avl_join(avl_t *left, int key, avl_t *right);
+avl_t *avl_split(avl_t *tree, int key, avl_t **left, avl_t **right);
+avl_t *avl_split_last(avl_t *tree, avl_t **last);
+avl_t *avl_join2(avl_t *left, avl_t *right);
+avl_t *avl_union(avl_t *a, avl_t *b);
+avl_t *avl_intersect(avl_t *a, avl_t *b);
+avl_t *avl_difference(avl_t *a, avl_t *b);
+/*===========================================================================*/
+
+/* Task (150) 66. AVL - Parallel set operations */
+avl_t *avl_set_sequential(avl_t *a, avl_t *b, int op);
+void *avl_set_task(void *arg);
+avl_t *avl_set_combine(int op, avl_t *left, avl_t *pivot, avl_t *duplicate,
+		       avl_t *right);
+avl_t *avl_set_parallel(avl_t *a, avl_t *b, int op, size_t threads);
+size_t avl_set_threads(const avl_t *a, const avl_t *b, size_t threads);
+avl_t *avl_union_parallel(avl_t *a, avl_t *b, size_t threads);
+avl_t *avl_intersect_parallel(avl_t *a, avl_t *b, size_t threads);
+avl_t *avl_difference_parallel(avl_t *a, avl_t *b, size_t threads);
+/*===========================================================================*/
+
 
 
 						/*	MAHMOUD EL SHERBINE */